@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+#include "ai/AI.hpp"
+#include "board/Board.hpp"
+#include "moves/MoveGenerator.hpp"
+#include <string>
+#include <vector>
+
+namespace {
+struct BenchPosition {
+    const char* name;
+    const char* fen;
+};
+
+const BenchPosition POSITIONS[] = {
+    {"start", "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"},
+    {"kiwipete", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"},
+    {"middlegame", "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10"},
+    {"endgame", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"},
+};
+const int POSITION_COUNT = sizeof(POSITIONS) / sizeof(POSITIONS[0]);
+
+Board loadPosition(benchmark::State& state, Piece::Color& sideToMove) {
+    const BenchPosition& position = POSITIONS[state.range(0)];
+    state.SetLabel(position.name);
+    Board board;
+    board.setupFromFEN(position.fen, sideToMove);
+    return board;
+}
+}
+
+static void BM_BoardCopy(benchmark::State& state) {
+    Piece::Color side;
+    const Board board = loadPosition(state, side);
+    for (auto _ : state) {
+        Board copy(board);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_BoardCopy)->DenseRange(0, POSITION_COUNT - 1);
+
+// Plays every legal move from a fresh copy, so each item includes one BM_BoardCopy.
+static void BM_MovePiece(benchmark::State& state) {
+    Piece::Color side;
+    const Board board = loadPosition(state, side);
+    const std::vector<Move> moves = MoveGenerator::generateAllMoves(&board, side);
+    for (auto _ : state) {
+        for (const Move& move : moves) {
+            Board copy(board);
+            benchmark::DoNotOptimize(copy.movePiece(move.getFrom(), move.getTo()));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * moves.size());
+}
+BENCHMARK(BM_MovePiece)->DenseRange(0, POSITION_COUNT - 1);
+
+static void BM_IsPositionAttacked(benchmark::State& state) {
+    Piece::Color side;
+    const Board board = loadPosition(state, side);
+    for (auto _ : state) {
+        for (int index = 0; index < Board::SQUARE_COUNT; ++index) {
+            const Position position = Position::fromIndex(index);
+            benchmark::DoNotOptimize(board.isPositionAttacked(position, Piece::Color::White));
+            benchmark::DoNotOptimize(board.isPositionAttacked(position, Piece::Color::Black));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * Board::SQUARE_COUNT * 2);
+}
+BENCHMARK(BM_IsPositionAttacked)->DenseRange(0, POSITION_COUNT - 1);
+
+static void BM_IsCheck(benchmark::State& state) {
+    Piece::Color side;
+    const Board board = loadPosition(state, side);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(board.isCheck(Piece::Color::White));
+        benchmark::DoNotOptimize(board.isCheck(Piece::Color::Black));
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_IsCheck)->DenseRange(0, POSITION_COUNT - 1);
+
+static void BM_GenerateAllMoves(benchmark::State& state) {
+    Piece::Color side;
+    const Board board = loadPosition(state, side);
+    for (auto _ : state) {
+        std::vector<Move> moves = MoveGenerator::generateAllMoves(&board, side);
+        benchmark::DoNotOptimize(moves.data());
+    }
+}
+BENCHMARK(BM_GenerateAllMoves)->DenseRange(0, POSITION_COUNT - 1);
+
+static void BM_ToFEN(benchmark::State& state) {
+    Piece::Color side;
+    const Board board = loadPosition(state, side);
+    for (auto _ : state) {
+        std::string fen = board.toFEN();
+        benchmark::DoNotOptimize(fen.data());
+    }
+}
+BENCHMARK(BM_ToFEN)->DenseRange(0, POSITION_COUNT - 1);
+
+static void BM_SetupFromFEN(benchmark::State& state) {
+    const BenchPosition& position = POSITIONS[state.range(0)];
+    state.SetLabel(position.name);
+    const std::string fen = position.fen;
+    Board board;
+    Piece::Color side;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(board.setupFromFEN(fen, side));
+    }
+}
+BENCHMARK(BM_SetupFromFEN)->DenseRange(0, POSITION_COUNT - 1);
+
+static void BM_EvaluatePosition(benchmark::State& state) {
+    Piece::Color side;
+    const Board board = loadPosition(state, side);
+    AI ai;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ai.evaluatePosition(&board, side));
+    }
+}
+BENCHMARK(BM_EvaluatePosition)->DenseRange(0, POSITION_COUNT - 1);
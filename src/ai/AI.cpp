@@ -1,5 +1,7 @@
 #include "AI.hpp"
 #include "moves/MoveGenerator.hpp"
+#include "board/StaticExchange.hpp"
+#include "utils/Profiler.hpp"
 #include <chrono>
 #include <algorithm>
 
@@ -34,6 +36,11 @@ const int AI::KNIGHT_POSITION_BONUS[8][8] = {
     {-50,-40,-30,-30,-30,-30,-40,-50}
 };
 
+// Pruning margins in evaluation units (a pawn is worth 200), indexed by remaining depth.
+const int AI::FUTILITY_MARGIN[FUTILITY_DEPTH + 1] = {0, 400, 700};
+const int AI::REVERSE_FUTILITY_MARGIN[REVERSE_FUTILITY_DEPTH + 1] = {0, 300, 600, 900};
+const int AI::RAZOR_MARGIN[RAZOR_DEPTH + 1] = {0, 500, 800};
+
 AI::AI() : rng(std::chrono::system_clock::now().time_since_epoch().count()) {
 }
 
@@ -41,23 +48,50 @@ void AI::setSeed(unsigned int seed) const {
     rng.seed(seed);
 }
 
+void AI::setDepth(int depth) {
+    maxDepth = std::max(1, depth);
+}
+
 Move AI::getMove(const Board* board, Piece::Color color) const {
-    if (!board) return Move(Position(-1, -1), Position(-1, -1));
+    return search(board, color).move;
+}
 
-    if (board->isCheckmate(color) || board->isStalemate(color)) {
-        return Move(Position(-1, -1), Position(-1, -1));
+AI::SearchResult AI::search(const Board* board, Piece::Color color) const {
+    PROFILE_SCOPE("AI::search");
+    SearchResult result;
+    result.move = Move(Position(-1, -1), Position(-1, -1));
+    stats = SearchStats();
+    pvTable.assign(maxDepth + MAX_EXTENSIONS + 2, std::vector<Move>());
+    previousPv.clear();
+    timedOut = false;
+    startTime = std::chrono::steady_clock::now();
+    deadline = startTime + timeLimit;
+
+    if (!board) return result;
+
+    if (book && book->probe(board, color, rng, result.move)) {
+        return result;
+    }
+
+    if (board->isCheckmate(color)) {
+        result.score = -MATE_SCORE;
+        return result;
+    }
+    if (board->isStalemate(color)) {
+        return result;
     }
 
     std::vector<Move> possibleMoves = MoveGenerator::generateAllMoves(board, color);
     if (possibleMoves.empty()) {
-        return Move(Position(-1, -1), Position(-1, -1));
+        return result;
     }
 
     if (board->isCheck(color)) {
         std::vector<Move> defendingMoves;
+        Board tempBoard(*board);
         for (const Move& move : possibleMoves) {
-            Board tempBoard(*board);
-            if (tempBoard.movePiece(move.getFrom(), move.getTo()) && !tempBoard.isCheck(color)) {
+            tempBoard = *board;
+            if (tempBoard.applyMove(move) && !tempBoard.isCheck(color)) {
                 defendingMoves.push_back(move);
             }
         }
@@ -66,44 +100,318 @@ Move AI::getMove(const Board* board, Piece::Color color) const {
         }
     }
 
-    Move bestMove = possibleMoves[0];
-    int bestScore = -999999;
+    rootPieceCount = Tablebase::pieceCount(board);
+    if (rootPieceCount <= tablebasePieces) {
+        filterTablebaseMoves(board, color, possibleMoves);
+    }
 
-    for (const Move& move : possibleMoves) {
-        Board tempBoard(*board);
-        if (tempBoard.movePiece(move.getFrom(), move.getTo())) {
-            int score = -negamax(&tempBoard, maxDepth - 1, -999999, 999999, 
-                               color == Piece::Color::White ? Piece::Color::Black : Piece::Color::White);
-            
-            if (score > bestScore) {
-                bestScore = score;
-                bestMove = move;
-            }
+    result.move = possibleMoves[0];
+    for (int depth = 1; depth <= maxDepth; depth++) {
+        for (auto line = result.lines.rbegin(); line != result.lines.rend(); ++line) {
+            moveToFront(possibleMoves, line->move);
+        }
+        std::vector<PvLine> lines;
+        if (!searchRoot(board, color, possibleMoves, depth, lines) || lines.empty()) {
+            break;
+        }
+        result.move = lines.front().move;
+        result.score = lines.front().score;
+        result.depth = depth;
+        result.lines.swap(lines);
+        previousPv = result.lines.front().pv;
+        if (onIteration) {
+            result.stats = stats;
+            result.stats.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - startTime);
+            onIteration(result);
+        }
+    }
+
+    result.stats = stats;
+    result.stats.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime);
+    return result;
+}
+
+std::uint64_t AI::SearchStats::cutoffs() const {
+    std::uint64_t total = 0;
+    for (std::uint64_t count : cutoffIndex) {
+        total += count;
+    }
+    return total;
+}
+
+long long AI::SearchStats::elapsedMs() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+}
+
+std::uint64_t AI::SearchStats::nodesPerSecond() const {
+    const long long micros = std::max<long long>(1, elapsed.count());
+    return nodes * 1000000ULL / micros;
+}
+
+bool AI::isStopped() const {
+    if (!timedOut && timeLimit.count() > 0 && std::chrono::steady_clock::now() >= deadline) {
+        timedOut = true;
+    }
+    return timedOut || (stopFlag && stopFlag->load(std::memory_order_relaxed));
+}
+
+// Keeps only the moves that preserve the best tablebase result, the search then
+// picks among them. Leaves the list alone if any reply cannot be probed.
+void AI::filterTablebaseMoves(const Board* board, Piece::Color color, std::vector<Move>& moves) const {
+    const Piece::Color opponent = color == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
+    std::vector<int> values;
+    int bestValue = -2;
+
+    Board tempBoard(*board);
+    for (const Move& move : moves) {
+        tempBoard = *board;
+        if (!tempBoard.applyMove(move) || tempBoard.isCheck(color)) {
+            values.push_back(-2);
+            continue;
+        }
+        Tablebase::Wdl wdl;
+        if (!Tablebase::probeWdl(&tempBoard, opponent, wdl)) {
+            return;
+        }
+        values.push_back(-static_cast<int>(wdl));
+        bestValue = std::max(bestValue, values.back());
+    }
+
+    std::vector<Move> preserving;
+    for (std::size_t i = 0; i < moves.size(); ++i) {
+        if (values[i] == bestValue) {
+            preserving.push_back(moves[i]);
+        }
+    }
+    moves.swap(preserving);
+    if (bestValue == 1 || bestValue == -1) {
+        filterDtzMoves(board, color, moves);
+    }
+}
+
+// WDL alone cannot tell progress from shuffling, so in a won or lost ending keep
+// the moves with the lowest Syzygy DTZ after the move: the fastest win, or the
+// loss that takes longest to reach a capture or pawn move. Does nothing unless
+// every move can be probed.
+void AI::filterDtzMoves(const Board* board, Piece::Color color, std::vector<Move>& moves) const {
+    const Piece::Color opponent = color == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
+    std::vector<int> values;
+
+    Board tempBoard(*board);
+    for (const Move& move : moves) {
+        const Square* target = board->getSquare(move.getTo());
+        const bool zeroing = (target && target->isOccupied()) || move.getType() == Move::Type::EnPassant ||
+                             board->getSquare(move.getFrom())->getPiece()->getType() == Piece::Type::Pawn;
+        tempBoard = *board;
+        tempBoard.applyMove(move);
+
+        int dtz = 0;
+        if (tempBoard.isCheckmate(opponent)) {
+            dtz = 1;
+        } else if (!Tablebase::probeDtz(&tempBoard, opponent, dtz)) {
+            return;
+        } else if (zeroing) {
+            dtz = dtz > 0 ? -1 : dtz < 0 ? 1 : 0;
+        } else {
+            dtz = -dtz + (dtz > 0 ? -1 : dtz < 0 ? 1 : 0);
+        }
+        values.push_back(dtz);
+    }
+
+    const int bestValue = *std::min_element(values.begin(), values.end());
+    std::vector<Move> fastest;
+    for (std::size_t i = 0; i < moves.size(); ++i) {
+        if (values[i] == bestValue) {
+            fastest.push_back(moves[i]);
+        }
+    }
+    moves.swap(fastest);
+}
+
+// All MultiPV lines come from one pass over the root moves: a move only needs an
+// exact score if it can still displace the weakest of the lines kept so far, so
+// that line's score is the bound for every later move.
+bool AI::searchRoot(const Board* board, Piece::Color color, const std::vector<Move>& moves,
+                    int depth, std::vector<PvLine>& lines) const {
+    const Piece::Color opponent = color == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
+    const std::size_t lineCount = static_cast<std::size_t>(multiPv);
+
+    Board tempBoard(*board);
+    for (const Move& move : moves) {
+        tempBoard = *board;
+        if (!tempBoard.applyMove(move)) {
+            continue;
+        }
+        const bool full = lines.size() >= lineCount;
+        const int bound = full ? lines.back().score : -MATE_SCORE;
+        followPv = !previousPv.empty() && move == previousPv.front();
+        int score = -negamax(&tempBoard, depth - 1, 1, 0, -MATE_SCORE, -bound, opponent);
+        if (isStopped()) {
+            return false;
+        }
+        if (full && score <= bound) {
+            continue;
+        }
+
+        PvLine line;
+        line.move = move;
+        line.score = score;
+        line.pv.push_back(move);
+        line.pv.insert(line.pv.end(), pvTable[1].begin(), pvTable[1].end());
+        auto position = std::upper_bound(lines.begin(), lines.end(), score,
+                                         [](int value, const PvLine& other) { return value > other.score; });
+        lines.insert(position, std::move(line));
+        if (lines.size() > lineCount) {
+            lines.pop_back();
         }
     }
 
-    return bestMove;
+    return true;
 }
 
-int AI::negamax(Board* board, int depth, int alpha, int beta, Piece::Color color) const {
+// Checks and forced replies are searched one ply deeper, at most MAX_EXTENSIONS
+// times along any path so a run of checks cannot blow the search up.
+int AI::negamax(Board* board, int depth, int ply, int extensions, int alpha, int beta, Piece::Color color) const {
+    PROFILE_COUNT("AI::negamax node");
+    // Only the first child down the previous PV is told it is on it.
+    const bool onPv = followPv && static_cast<std::size_t>(ply) < previousPv.size();
+    followPv = false;
+    if (isStopped()) {
+        return 0;
+    }
+    pvTable[ply].clear();
+    const bool inCheck = board->isCheck(color);
+    bool extended = false;
+    if (inCheck && extensions < MAX_EXTENSIONS) {
+        depth++;
+        extensions++;
+        extended = true;
+        stats.extensions++;
+    }
     if (depth == 0) {
-        return evaluatePosition(board, color);
+        return quiescence(board, ply, alpha, beta, color);
+    }
+    stats.nodes++;
+    stats.selectiveDepth = std::max(stats.selectiveDepth, ply);
+
+    int tablebaseScore = 0;
+    if (probeTablebase(board, color, ply, tablebaseScore)) {
+        return tablebaseScore;
+    }
+
+    // Near the leaves a static evaluation far outside the window decides the node
+    // without trying every move. Never in check, and never against a mate-score bound.
+    const bool canPrune = !inCheck && depth <= REVERSE_FUTILITY_DEPTH;
+    const int staticEval = canPrune ? evaluatePosition(board, color) : 0;
+    if (canPrune && beta < TABLEBASE_WIN && staticEval - REVERSE_FUTILITY_MARGIN[depth] >= beta) {
+        return beta;
+    }
+    const bool belowAlpha = canPrune && alpha > -TABLEBASE_WIN;
+    if (belowAlpha && depth <= RAZOR_DEPTH && staticEval + RAZOR_MARGIN[depth] <= alpha) {
+        const int score = quiescence(board, ply, alpha, beta, color);
+        if (score <= alpha) {
+            return alpha;
+        }
     }
 
     std::vector<Move> moves = MoveGenerator::generateAllMoves(board, color);
-    if (moves.empty()) {
-        if (board->isCheckmate(color)) {
-            return -999999;
+    Board tempBoard(*board);
+    if (inCheck) {
+        std::vector<Move> evasions;
+        for (const Move& move : moves) {
+            tempBoard = *board;
+            if (tempBoard.applyMove(move) && !tempBoard.isCheck(color)) {
+                evasions.push_back(move);
+            }
         }
-        return 0; 
+        moves.swap(evasions);
+    }
+    if (moves.empty()) {
+        return inCheck ? ply - MATE_SCORE : 0;
+    }
+    if (moves.size() == 1 && !extended && extensions < MAX_EXTENSIONS) {
+        depth++;
+        extensions++;
+        stats.extensions++;
+    }
+
+    const bool futile = belowAlpha && depth <= FUTILITY_DEPTH && staticEval + FUTILITY_MARGIN[depth] <= alpha;
+    const Piece::Color opponent = color == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
+
+    orderMoves(board, moves);
+    if (onPv) {
+        moveToFront(moves, previousPv[ply]);
     }
 
+    int moveIndex = 0;
     for (const Move& move : moves) {
-        Board tempBoard(*board);
-        if (tempBoard.movePiece(move.getFrom(), move.getTo())) {
-            int score = -negamax(&tempBoard, depth - 1, -beta, -alpha,
-                               color == Piece::Color::White ? Piece::Color::Black : Piece::Color::White);
-            
+        tempBoard = *board;
+        if (!tempBoard.applyMove(move)) {
+            continue;
+        }
+        // Quiet moves cannot lift a futile node back to alpha unless they give check.
+        if (futile && !isTactical(board, move) && !tempBoard.isCheck(opponent)) {
+            continue;
+        }
+        followPv = onPv && move == previousPv[ply];
+        int score = -negamax(&tempBoard, depth - 1, ply + 1, extensions, -beta, -alpha, opponent);
+        if (score >= beta) {
+            stats.cutoffIndex[std::min(moveIndex, SearchStats::CUTOFF_BUCKETS - 1)]++;
+            return beta;
+        }
+        moveIndex++;
+        if (score > alpha) {
+            alpha = score;
+            std::vector<Move>& line = pvTable[ply];
+            line.assign(1, move);
+            line.insert(line.end(), pvTable[ply + 1].begin(), pvTable[ply + 1].end());
+        }
+    }
+
+    return alpha;
+}
+
+// Captures only, past the nominal depth, so the static evaluation is never taken
+// in the middle of an exchange. Captures that lose material by SEE are skipped.
+int AI::quiescence(Board* board, int ply, int alpha, int beta, Piece::Color color) const {
+    if (isStopped()) {
+        return 0;
+    }
+    stats.nodes++;
+    stats.qnodes++;
+    stats.selectiveDepth = std::max(stats.selectiveDepth, ply);
+
+    int tablebaseScore = 0;
+    if (probeTablebase(board, color, ply, tablebaseScore)) {
+        return tablebaseScore;
+    }
+
+    const int standPat = evaluatePosition(board, color);
+    if (standPat >= beta) {
+        return beta;
+    }
+    alpha = std::max(alpha, standPat);
+
+    std::vector<std::pair<int, Move>> captures;
+    for (const Move& move : MoveGenerator::generateAllMoves(board, color)) {
+        if (isTactical(board, move)) {
+            const int exchange = StaticExchange::evaluate(*board, move);
+            if (exchange >= 0) {
+                captures.emplace_back(exchange, move);
+            }
+        }
+    }
+    std::stable_sort(captures.begin(), captures.end(),
+                     [](const std::pair<int, Move>& a, const std::pair<int, Move>& b) { return a.first > b.first; });
+
+    Board tempBoard(*board);
+    for (const auto& capture : captures) {
+        tempBoard = *board;
+        if (tempBoard.applyMove(capture.second)) {
+            int score = -quiescence(&tempBoard, ply + 1, -beta, -alpha,
+                                    color == Piece::Color::White ? Piece::Color::Black : Piece::Color::White);
             if (score >= beta) {
                 return beta;
             }
@@ -114,7 +422,58 @@ int AI::negamax(Board* board, int depth, int alpha, int beta, Piece::Color color
     return alpha;
 }
 
+// Only probe after a capture below the root, so the search still has to
+// make progress inside an endgame it started in.
+bool AI::probeTablebase(const Board* board, Piece::Color color, int ply, int& score) const {
+    if (tablebasePieces == 0) {
+        return false;
+    }
+    const int pieces = Tablebase::pieceCount(board);
+    Tablebase::Wdl wdl;
+    if (pieces < rootPieceCount && pieces <= tablebasePieces &&
+        Tablebase::probeWdl(board, color, wdl)) {
+        stats.tablebaseHits++;
+        score = static_cast<int>(wdl) * (TABLEBASE_WIN - ply);
+        return true;
+    }
+    return false;
+}
+
+bool AI::isTactical(const Board* board, const Move& move) {
+    const Square* target = board->getSquare(move.getTo());
+    return (target && target->isOccupied()) || move.getType() == Move::Type::EnPassant ||
+           move.getType() == Move::Type::Promotion;
+}
+
+// Winning and even captures by SEE first, then quiet moves, then losing captures.
+void AI::orderMoves(const Board* board, std::vector<Move>& moves) const {
+    std::vector<std::pair<int, Move>> keyed;
+    keyed.reserve(moves.size());
+    for (const Move& move : moves) {
+        int key = 0;
+        if (isTactical(board, move)) {
+            const int exchange = StaticExchange::evaluate(*board, move);
+            key = exchange >= 0 ? GOOD_CAPTURE_ORDER + exchange : BAD_CAPTURE_ORDER + exchange;
+        }
+        keyed.emplace_back(key, move);
+    }
+    std::stable_sort(keyed.begin(), keyed.end(),
+                     [](const std::pair<int, Move>& a, const std::pair<int, Move>& b) { return a.first > b.first; });
+    for (std::size_t i = 0; i < moves.size(); ++i) {
+        moves[i] = keyed[i].second;
+    }
+}
+
+// Keeps the relative order of the other moves; does nothing if `move` is absent.
+void AI::moveToFront(std::vector<Move>& moves, const Move& move) {
+    auto found = std::find(moves.begin(), moves.end(), move);
+    if (found != moves.end()) {
+        std::rotate(moves.begin(), found, found + 1);
+    }
+}
+
 int AI::evaluatePosition(const Board* board, Piece::Color color) const {
+    PROFILE_SCOPE("AI::evaluatePosition");
     int score = 0;
     
     score += evaluateMaterial(board, color) * 2;
@@ -157,7 +516,7 @@ int AI::evaluatePositionalAdvantage(const Board* board, Piece::Color color) cons
             Position pos(x, y);
             const Square* square = board->getSquare(pos);
             if (square && square->isOccupied()) {
-                Piece* piece = square->getPiece();
+                const Piece* piece = square->getPiece();
                 if (piece->getColor() == color) {
                     if (piece->getType() == Piece::Type::Pawn) {
                         score += evaluatePawnPosition(pos, color);
@@ -197,7 +556,7 @@ int AI::evaluateKnightPosition(const Position& pos, Piece::Color color) const {
 
 int AI::evaluateKingSafety(const Board* board, Piece::Color color) const {
     int score = 0;
-    Piece* king = board->getKing(color);
+    const Piece* king = board->getKing(color);
     if (!king) return 0;
 
     Position kingPos = king->getPosition();
@@ -303,7 +662,7 @@ int AI::evaluateDevelopment(const Board* board, Piece::Color color) const {
     return score;
 }
 
-Piece* AI::selectRandomPiece(const std::vector<Piece*>& pieces) const {
+const Piece* AI::selectRandomPiece(const std::vector<const Piece*>& pieces) const {
     if (pieces.empty()) {
         return nullptr;
     }
@@ -350,9 +709,9 @@ bool AI::isCriticalPosition(const Board* board, Piece::Color color) const {
            board->isStalemate(color);
 }
 
-Piece* AI::findPieceWithMoves(const Board* board, Piece::Color color) const {
+const Piece* AI::findPieceWithMoves(const Board* board, Piece::Color color) const {
     auto pieces = board->getPieces(color);
-    std::vector<Piece*> piecesWithMoves;
+    std::vector<const Piece*> piecesWithMoves;
 
     for (auto piece : pieces) {
         auto moves = MoveGenerator::generateLegalMoves(board, piece->getPosition());
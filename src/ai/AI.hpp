@@ -2,34 +2,155 @@
 #include "board/Board.hpp"
 #include "moves/Move.hpp"
 #include "game/GameState.hpp"
+#include "ai/OpeningBook.hpp"
+#include "ai/Tablebase.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <functional>
 #include <random>
 #include <vector>
 #include <map>
 
 class AI {
 public:
+    // Counters are cumulative over all iterations of one search() call.
+    struct SearchStats {
+        static const int CUTOFF_BUCKETS = 8;
+
+        std::uint64_t nodes = 0;
+        // qnodes counts the quiescence share of nodes. The TT counters stay zero until
+        // the search has a transposition table; they are here so the report format is stable.
+        std::uint64_t qnodes = 0;
+        std::uint64_t ttProbes = 0;
+        std::uint64_t ttHits = 0;
+        std::uint64_t tablebaseHits = 0;
+        // Plies added for checks and single-reply positions.
+        std::uint64_t extensions = 0;
+        // Index of the move that failed high among the legal moves tried; the last bucket is "7 or later".
+        std::array<std::uint64_t, CUTOFF_BUCKETS> cutoffIndex{};
+        int selectiveDepth = 0;
+        std::chrono::microseconds elapsed{0};
+
+        std::uint64_t cutoffs() const;
+        long long elapsedMs() const;
+        std::uint64_t nodesPerSecond() const;
+    };
+
+    // A root move with its exact score and the continuation the search expects.
+    struct PvLine {
+        Move move;
+        int score = 0;
+        std::vector<Move> pv;
+    };
+
+    struct SearchResult {
+        Move move;
+        int score = 0;
+        int depth = 0;
+        // Best first, one per MultiPV line; fewer when there are fewer legal moves.
+        // lines.front().pv is the principal variation of the iteration.
+        std::vector<PvLine> lines;
+        SearchStats stats;
+    };
+
+    using IterationCallback = std::function<void(const SearchResult&)>;
+
+    static const int SCORE_PER_CENTIPAWN = 2;
+    // Being mated `ply` plies from the root scores -(MATE_SCORE - ply), so the
+    // search prefers the shortest mate. Tablebase results are TABLEBASE_WIN
+    // minus the ply, so any score at least TABLEBASE_WIN in size is a decided game.
+    static const int MATE_SCORE = 999999;
+    static const int MAX_MATE_PLY = 1000;
+    static const int TABLEBASE_WIN = 500000;
+
     AI();
     ~AI() = default;
 
     Move getMove(const Board* board, Piece::Color color) const;
+    // Score is from the side to move's point of view, depth is the last completed iteration.
+    SearchResult search(const Board* board, Piece::Color color) const;
     void setSeed(unsigned int seed) const;
+    void setDepth(int depth);
+    int getDepth() const { return maxDepth; }
+    // When the flag is raised getMove returns the best move of the last completed depth.
+    void setStopFlag(const std::atomic<bool>* flag) { stopFlag = flag; }
+    // Static evaluation from `color`'s point of view in search units: material
+    // counts double, so a pawn is worth 200. Use toCentipawns for reporting.
+    int evaluatePosition(const Board* board, Piece::Color color) const;
+    static int toCentipawns(int score) { return score / SCORE_PER_CENTIPAWN; }
+    static bool isMateScore(int score) { return std::abs(score) > MATE_SCORE - MAX_MATE_PLY; }
+    // Moves to mate for a mate score: positive when the side to move mates, negative when it is mated.
+    static int mateInMoves(int score) {
+        const int plies = MATE_SCORE - std::abs(score);
+        return score > 0 ? (plies + 1) / 2 : -(plies / 2);
+    }
+    // Called on the searching thread after every completed iteration.
+    void setIterationCallback(IterationCallback callback) { onIteration = std::move(callback); }
+    // Zero disables the limit.
+    void setTimeLimit(std::chrono::milliseconds limit) { timeLimit = limit; }
+    // A book hit is returned at depth 0 without searching; the book must outlive the AI.
+    void setOpeningBook(const OpeningBook* openingBook) { book = openingBook; }
+    // Positions with at most this many pieces are scored by Tablebase; 0 disables probing.
+    void setTablebasePieces(int pieces) { tablebasePieces = std::max(0, std::min(pieces, Tablebase::MAX_PIECES)); }
+    // Number of root moves that get an exact score and a line; 1 is a normal search.
+    void setMultiPv(int lines) { multiPv = std::max(1, lines); }
+    int getMultiPv() const { return multiPv; }
 
 private:
     static const std::map<Piece::Type, int> PIECE_VALUES;
     static const int PAWN_POSITION_BONUS[8][8];
     static const int KNIGHT_POSITION_BONUS[8][8];
+    static const int GOOD_CAPTURE_ORDER = 100000;
+    static const int BAD_CAPTURE_ORDER = -100000;
+    static const int MAX_EXTENSIONS = 4;
+    static const int FUTILITY_DEPTH = 2;
+    static const int REVERSE_FUTILITY_DEPTH = 3;
+    static const int RAZOR_DEPTH = 2;
+    static const int FUTILITY_MARGIN[FUTILITY_DEPTH + 1];
+    static const int REVERSE_FUTILITY_MARGIN[REVERSE_FUTILITY_DEPTH + 1];
+    static const int RAZOR_MARGIN[RAZOR_DEPTH + 1];
     
-    const int maxDepth = 3;
+    int maxDepth = 3;
+    const std::atomic<bool>* stopFlag = nullptr;
+    const OpeningBook* book = nullptr;
+    int tablebasePieces = Tablebase::MAX_PIECES;
+    int multiPv = 1;
+    mutable int rootPieceCount = 0;
+    std::chrono::milliseconds timeLimit{0};
+    mutable std::chrono::steady_clock::time_point deadline;
+    mutable bool timedOut = false;
+    mutable SearchStats stats;
+    // Triangular PV table: row `ply` holds the best line found from that ply down.
+    mutable std::vector<std::vector<Move>> pvTable;
+    // Principal variation of the previous iteration, searched first in the next one.
+    mutable std::vector<Move> previousPv;
+    mutable bool followPv = false;
+    mutable std::chrono::steady_clock::time_point startTime;
+    IterationCallback onIteration;
     mutable std::mt19937 rng;
 
-    Piece* selectRandomPiece(const std::vector<Piece*>& pieces) const;
+    bool isStopped() const;
+    void filterTablebaseMoves(const Board* board, Piece::Color color, std::vector<Move>& moves) const;
+    void filterDtzMoves(const Board* board, Piece::Color color, std::vector<Move>& moves) const;
+    bool searchRoot(const Board* board, Piece::Color color, const std::vector<Move>& moves,
+                    int depth, std::vector<PvLine>& lines) const;
+
+    const Piece* selectRandomPiece(const std::vector<const Piece*>& pieces) const;
     Move selectRandomMove(const std::vector<Move>& moves) const;
     bool handleSpecialCases(const Board* board, Piece::Color color, Move& selectedMove) const;
     bool isCriticalPosition(const Board* board, Piece::Color color) const;
-    Piece* findPieceWithMoves(const Board* board, Piece::Color color) const;
+    const Piece* findPieceWithMoves(const Board* board, Piece::Color color) const;
 
-    int negamax(Board* board, int depth, int alpha, int beta, Piece::Color color) const;
-    int evaluatePosition(const Board* board, Piece::Color color) const;
+    int negamax(Board* board, int depth, int ply, int extensions, int alpha, int beta, Piece::Color color) const;
+    int quiescence(Board* board, int ply, int alpha, int beta, Piece::Color color) const;
+    bool probeTablebase(const Board* board, Piece::Color color, int ply, int& score) const;
+    static bool isTactical(const Board* board, const Move& move);
+    void orderMoves(const Board* board, std::vector<Move>& moves) const;
+    static void moveToFront(std::vector<Move>& moves, const Move& move);
     int evaluateMaterial(const Board* board, Piece::Color color) const;
     int evaluatePositionalAdvantage(const Board* board, Piece::Color color) const;
     int evaluatePawnPosition(const Position& pos, Piece::Color color) const;
@@ -0,0 +1,51 @@
+#pragma once
+#include "board/Board.hpp"
+#include "moves/Move.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+class MappedFile;
+
+// Polyglot-format (.bin) book: 16-byte big-endian entries sorted by key,
+// memory-mapped and binary-searched, so a probe touches a handful of pages.
+class OpeningBook {
+public:
+    struct Entry {
+        std::uint64_t key = 0;
+        std::uint16_t move = 0;
+        std::uint16_t weight = 0;
+        std::uint32_t learn = 0;
+    };
+
+    static const std::size_t ENTRY_SIZE = 16;
+
+    OpeningBook();
+    ~OpeningBook();
+
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return file != nullptr; }
+    std::size_t size() const { return entryCount; }
+
+    std::vector<Entry> lookup(std::uint64_t key) const;
+    // Picks one legal book move with probability proportional to its weight.
+    bool probe(const Board* board, Piece::Color color, std::mt19937& rng, Move& move) const;
+
+    // Key laid out as in the Polyglot spec: 768 piece-square, 4 castling,
+    // 8 en passant file and 1 side-to-move random numbers.
+    static std::uint64_t hash(const Board* board, Piece::Color color);
+    static std::uint16_t encodeMove(const Move& move, const Board* board);
+    static bool decodeMove(std::uint16_t code, const Board* board, Piece::Color color, Move& move);
+    // Sorts the entries by key and writes them in book format.
+    static bool write(const std::string& path, std::vector<Entry> entries);
+
+private:
+    std::unique_ptr<MappedFile> file;
+    std::size_t entryCount;
+
+    Entry entryAt(std::size_t index) const;
+};
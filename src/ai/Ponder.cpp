@@ -0,0 +1,79 @@
+#include "Ponder.hpp"
+
+Ponder::Ponder()
+    : stopFlag(false)
+    , hasPrediction(false)
+    , expectedHash(0)
+    , expectedColor(Piece::Color::White) {
+    predictor.setStopFlag(&stopFlag);
+    searcher.setStopFlag(&stopFlag);
+}
+
+Ponder::~Ponder() {
+    stop();
+}
+
+void Ponder::start(const Board& board, Piece::Color opponent, int depth) {
+    stop();
+
+    stopFlag = false;
+    hasPrediction = false;
+    result = Move(Position(-1, -1), Position(-1, -1));
+    predictor.setDepth(depth > 1 ? depth - 1 : 1);
+    searcher.setDepth(depth);
+
+    worker = std::thread(&Ponder::run, this, board, opponent);
+}
+
+bool Ponder::takeMove(const Board& board, Piece::Color color, Move& move) {
+    if (!worker.joinable()) {
+        return false;
+    }
+
+    bool hit;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        predicted.wait(lock, [this] { return hasPrediction; });
+        hit = expectedColor == color && expectedHash == board.getHash();
+    }
+
+    if (!hit) {
+        stop();
+        return false;
+    }
+
+    worker.join();
+    if (!result.getFrom().isValid()) {
+        return false;
+    }
+    move = result;
+    return true;
+}
+
+void Ponder::stop() {
+    stopFlag = true;
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void Ponder::run(Board board, Piece::Color opponent) {
+    const Move reply = predictor.getMove(&board, opponent);
+    const Piece::Color color = opponent == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
+    const bool valid = reply.getFrom().isValid() && !stopFlag && board.applyMove(reply);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        hasPrediction = true;
+        expectedHash = valid ? board.getHash() : 0;
+        expectedColor = valid ? color : opponent;
+    }
+    predicted.notify_all();
+
+    if (valid) {
+        const Move move = searcher.getMove(&board, color);
+        if (!stopFlag) {
+            result = move;
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "ai/AI.hpp"
+#include "board/Board.hpp"
+#include "moves/Move.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+// Searches on the opponent's time: predicts their reply and searches the
+// position after it on a background thread. If the reply is played, the running
+// search becomes the real one and its move is used without starting over.
+class Ponder {
+public:
+    Ponder();
+    ~Ponder();
+
+    void start(const Board& board, Piece::Color opponent, int depth);
+    // On a ponder hit waits for the search and returns its move, otherwise cancels it.
+    bool takeMove(const Board& board, Piece::Color color, Move& move);
+    void stop();
+
+    bool isRunning() const { return worker.joinable(); }
+
+private:
+    AI predictor;
+    AI searcher;
+    std::thread worker;
+    std::atomic<bool> stopFlag;
+    std::mutex mutex;
+    std::condition_variable predicted;
+    bool hasPrediction;
+    std::uint64_t expectedHash;
+    Piece::Color expectedColor;
+    Move result;
+
+    void run(Board board, Piece::Color opponent);
+};
@@ -0,0 +1,1015 @@
+#include "Syzygy.hpp"
+#include "moves/MoveGenerator.hpp"
+#include "utils/MappedFile.hpp"
+#include "utils/Profiler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+using Wdl = Syzygy::Wdl;
+
+const int MAX_PIECES = Syzygy::MAX_PIECES;
+const char PIECE_LETTERS[] = "PNBRQK";
+
+const std::uint8_t WDL_MAGIC[4] = {0x71, 0xE8, 0x23, 0x5D};
+const std::uint8_t DTZ_MAGIC[4] = {0xD7, 0x66, 0x0C, 0xA5};
+
+// Per-table flags; all but SingleValue only appear in DTZ files.
+enum TableFlag : std::uint8_t {
+    SideToMove = 1,
+    Mapped = 2,
+    WinPlies = 4,
+    LossPlies = 8,
+    Wide = 16,
+    SingleValue = 128
+};
+
+enum class ProbeState {
+    Fail,
+    Ok,
+    // The DTZ file only stores the other side to move.
+    ChangeSideToMove,
+    // The best move is a capture or pawn move, so the DTZ value is implied.
+    ZeroingBestMove
+};
+
+int fileOf(int square) { return square & 7; }
+int rankOf(int square) { return square >> 3; }
+std::uint64_t bit(int square) { return std::uint64_t(1) << square; }
+// Negative below the a1-h8 diagonal, positive above it.
+int offDiagonal(int square) { return rankOf(square) - fileOf(square); }
+int flipDiagonal(int square) { return ((square >> 3) | (square << 3)) & 63; }
+
+int distance(int a, int b) {
+    return std::max(std::abs(fileOf(a) - fileOf(b)), std::abs(rankOf(a) - rankOf(b)));
+}
+
+std::uint16_t readLittle16(const std::uint8_t* bytes) {
+    return static_cast<std::uint16_t>(bytes[0] | (bytes[1] << 8));
+}
+
+std::uint32_t readLittle32(const std::uint8_t* bytes) {
+    return std::uint32_t(bytes[0]) | (std::uint32_t(bytes[1]) << 8) |
+           (std::uint32_t(bytes[2]) << 16) | (std::uint32_t(bytes[3]) << 24);
+}
+
+std::uint32_t readBig32(const std::uint8_t* bytes) {
+    return (std::uint32_t(bytes[0]) << 24) | (std::uint32_t(bytes[1]) << 16) |
+           (std::uint32_t(bytes[2]) << 8) | std::uint32_t(bytes[3]);
+}
+
+std::uint64_t readBig64(const std::uint8_t* bytes) {
+    return (std::uint64_t(readBig32(bytes)) << 32) | readBig32(bytes + 4);
+}
+
+// Index tables shared by every file, built on first use.
+struct Encoding {
+    // Squares a2-h7 numbered so the leading pawn is the one with the highest value.
+    int mapPawns[64] = {};
+    // Squares below the a1-h8 diagonal as 0..27.
+    int mapB1H1H7[64] = {};
+    // The a1-d1-d4 triangle as 0..9, diagonal squares last.
+    int mapA1D1D4[64] = {};
+    // The 462 legal king pairs with the first king in the triangle.
+    int mapKK[10][64] = {};
+    std::uint64_t binomial[MAX_PIECES][64] = {};
+    std::uint64_t leadPawnIdx[MAX_PIECES][64] = {};
+    std::uint64_t leadPawnsSize[MAX_PIECES][4] = {};
+
+    Encoding() {
+        int code = 0;
+        for (int square = 0; square < 64; ++square) {
+            if (offDiagonal(square) < 0) {
+                mapB1H1H7[square] = code++;
+            }
+        }
+
+        std::vector<int> diagonal;
+        code = 0;
+        for (int square = 0; square <= 27; ++square) {
+            if (fileOf(square) > 3) {
+                continue;
+            }
+            if (offDiagonal(square) < 0) {
+                mapA1D1D4[square] = code++;
+            } else if (offDiagonal(square) == 0) {
+                diagonal.push_back(square);
+            }
+        }
+        for (int square : diagonal) {
+            mapA1D1D4[square] = code++;
+        }
+
+        // b1 is the only triangle square mapped to 0, the others left at 0 are outside it.
+        std::vector<std::pair<int, int>> bothOnDiagonal;
+        code = 0;
+        for (int index = 0; index < 10; ++index) {
+            for (int first = 0; first <= 27; ++first) {
+                if (mapA1D1D4[first] != index || (index == 0 && first != 1)) {
+                    continue;
+                }
+                for (int second = 0; second < 64; ++second) {
+                    if (distance(first, second) <= 1) {
+                        continue;
+                    }
+                    if (offDiagonal(first) == 0 && offDiagonal(second) > 0) {
+                        continue;
+                    }
+                    if (offDiagonal(first) == 0 && offDiagonal(second) == 0) {
+                        bothOnDiagonal.emplace_back(index, second);
+                    } else {
+                        mapKK[index][second] = code++;
+                    }
+                }
+            }
+        }
+        for (const auto& kings : bothOnDiagonal) {
+            mapKK[kings.first][kings.second] = code++;
+        }
+
+        binomial[0][0] = 1;
+        for (int n = 1; n < 64; ++n) {
+            for (int k = 0; k < MAX_PIECES && k <= n; ++k) {
+                binomial[k][n] = (k > 0 ? binomial[k - 1][n - 1] : 0) + (k < n ? binomial[k][n - 1] : 0);
+            }
+        }
+
+        int availableSquares = 47;
+        for (int leadPawns = 1; leadPawns < MAX_PIECES - 1; ++leadPawns) {
+            for (int file = 0; file < 4; ++file) {
+                std::uint64_t index = 0;
+                for (int rank = 1; rank <= 6; ++rank) {
+                    const int square = rank * 8 + file;
+                    if (leadPawns == 1) {
+                        mapPawns[square] = availableSquares--;
+                        mapPawns[square ^ 7] = availableSquares--;
+                    }
+                    leadPawnIdx[leadPawns][square] = index;
+                    index += binomial[leadPawns - 1][mapPawns[square]];
+                }
+                leadPawnsSize[leadPawns][file] = index;
+            }
+        }
+    }
+};
+
+const Encoding& encoding() {
+    static const Encoding tables;
+    return tables;
+}
+
+// Decoding state for one side to move (and one leading pawn file) of a file.
+// Values are Huffman-coded symbols in fixed-size blocks; a symbol can stand
+// for a pair of other symbols, so one symbol expands to symlen + 1 values.
+struct PairsData {
+    std::uint8_t flags = 0;
+    std::size_t blockSize = 0;
+    // A sparse index entry is stored for every `span` values.
+    std::size_t span = 0;
+    std::uint32_t blockCount = 0;
+    int maxSymLen = 0;
+    int minSymLen = 0;
+    const std::uint8_t* lowestSym = nullptr;
+    // Three bytes per symbol: the left and right symbol it expands to.
+    const std::uint8_t* btree = nullptr;
+    // Values in each block, minus one.
+    const std::uint8_t* blockLength = nullptr;
+    std::size_t blockLengthSize = 0;
+    const std::uint8_t* sparseIndex = nullptr;
+    std::size_t sparseIndexSize = 0;
+    const std::uint8_t* data = nullptr;
+    std::vector<std::uint64_t> base64;
+    std::vector<std::uint8_t> symlen;
+    int pieces[MAX_PIECES] = {};
+    std::uint64_t groupIdx[MAX_PIECES + 1] = {};
+    int groupLen[MAX_PIECES + 1] = {};
+    // Offsets into the DTZ value map for win, loss, cursed win and blessed loss.
+    std::uint16_t mapIdx[4] = {};
+};
+
+int leftSymbol(const std::uint8_t* btree, int symbol) {
+    const std::uint8_t* entry = btree + 3 * symbol;
+    return ((entry[1] & 0xF) << 8) | entry[0];
+}
+
+int rightSymbol(const std::uint8_t* btree, int symbol) {
+    const std::uint8_t* entry = btree + 3 * symbol;
+    return (entry[2] << 4) | (entry[1] >> 4);
+}
+
+struct Table {
+    bool dtz = false;
+    // File name without extension, e.g. "KRPvKR"; the left half is white in `key`.
+    std::string name;
+    std::uint64_t key = 0;
+    std::uint64_t key2 = 0;
+    int pieceCount = 0;
+    bool hasPawns = false;
+    bool hasUniquePieces = false;
+    // Leading colour first: the side with fewer pawns, or the only side with any.
+    int pawnCount[2] = {};
+    std::atomic<bool> ready{false};
+    std::unique_ptr<MappedFile> file;
+    const std::uint8_t* begin = nullptr;
+    const std::uint8_t* end = nullptr;
+    const std::uint8_t* dtzMap = nullptr;
+    PairsData items[2][4];
+
+    PairsData& get(int side, int file) { return items[dtz ? 0 : side][hasPawns ? file : 0]; }
+};
+
+struct Registry {
+    std::vector<std::string> directories;
+    std::vector<std::unique_ptr<Table>> tables;
+    // Material key to its WDL and DTZ table.
+    std::unordered_map<std::uint64_t, std::pair<Table*, Table*>> byKey;
+    int maxPieces = 0;
+    std::mutex mutex;
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+// Four bits per piece kind: white pawn..king, then black pawn..king.
+std::uint64_t materialKey(const int counts[2][6], bool swapColors) {
+    std::uint64_t key = 0;
+    for (int color = 0; color < 2; ++color) {
+        for (int type = 0; type < 6; ++type) {
+            key |= std::uint64_t(counts[color ^ (swapColors ? 1 : 0)][type]) << (4 * (6 * color + type));
+        }
+    }
+    return key;
+}
+
+// Board contents in file piece codes: 1-6 white pawn..king, 9-14 black.
+struct Material {
+    int pieces[64] = {};
+    int counts[2][6] = {};
+    int total = 0;
+
+    explicit Material(const Board* board) {
+        for (int index = 0; index < Board::SQUARE_COUNT; ++index) {
+            const Piece* piece = board->getSquareAt(index).getPiece();
+            if (!piece) {
+                continue;
+            }
+            const int color = piece->getColor() == Piece::Color::White ? 0 : 1;
+            const int type = static_cast<int>(piece->getType());
+            pieces[index] = type + 1 + 8 * color;
+            counts[color][type]++;
+            total++;
+        }
+    }
+
+    std::uint64_t key() const { return materialKey(counts, false); }
+};
+
+bool parseName(const std::string& name, int counts[2][6]) {
+    const std::size_t separator = name.find('v');
+    if (separator == std::string::npos || name.find('v', separator + 1) != std::string::npos) {
+        return false;
+    }
+    int total = 0;
+    for (int color = 0; color < 2; ++color) {
+        const std::string side = color == 0 ? name.substr(0, separator) : name.substr(separator + 1);
+        for (char letter : side) {
+            const char* type = std::strchr(PIECE_LETTERS, letter);
+            if (letter == '\0' || !type) {
+                return false;
+            }
+            counts[color][type - PIECE_LETTERS]++;
+            total++;
+        }
+        if (counts[color][5] != 1) {
+            return false;
+        }
+    }
+    return total > 2 && total <= MAX_PIECES;
+}
+
+void describe(Table& table, const std::string& name, const int counts[2][6], bool dtz) {
+    table.dtz = dtz;
+    table.name = name;
+    table.key = materialKey(counts, false);
+    table.key2 = materialKey(counts, true);
+    table.hasPawns = counts[0][0] + counts[1][0] > 0;
+    for (int color = 0; color < 2; ++color) {
+        for (int type = 0; type < 6; ++type) {
+            table.pieceCount += counts[color][type];
+            if (type != 5 && counts[color][type] == 1) {
+                table.hasUniquePieces = true;
+            }
+        }
+    }
+    const int lead = !counts[1][0] || (counts[0][0] && counts[1][0] >= counts[0][0]) ? 0 : 1;
+    table.pawnCount[0] = counts[lead][0];
+    table.pawnCount[1] = counts[1 - lead][0];
+}
+
+// Splits the pieces into groups that are indexed together: the leading group
+// (two kings, three unique pieces or the leading pawns), then runs of
+// identical pieces. `order` says where the leading group and the other side's
+// pawns sit in the mixed-radix index.
+void setGroups(const Table& table, PairsData& d, const int order[2], int file) {
+    const Encoding& tables = encoding();
+    int n = 0;
+    int firstLen = table.hasPawns ? 0 : table.hasUniquePieces ? 3 : 2;
+    d.groupLen[n] = 1;
+    for (int i = 1; i < table.pieceCount; ++i) {
+        if (--firstLen > 0 || d.pieces[i] == d.pieces[i - 1]) {
+            d.groupLen[n]++;
+        } else {
+            d.groupLen[++n] = 1;
+        }
+    }
+    d.groupLen[++n] = 0;
+
+    const bool pawnsOnBothSides = table.hasPawns && table.pawnCount[1];
+    int next = pawnsOnBothSides ? 2 : 1;
+    int freeSquares = 64 - d.groupLen[0] - (pawnsOnBothSides ? d.groupLen[1] : 0);
+    std::uint64_t index = 1;
+    for (int k = 0; next < n || k == order[0] || k == order[1]; ++k) {
+        if (k == order[0]) {
+            d.groupIdx[0] = index;
+            index *= table.hasPawns ? tables.leadPawnsSize[d.groupLen[0]][file]
+                                    : table.hasUniquePieces ? 31332 : 462;
+        } else if (k == order[1]) {
+            d.groupIdx[1] = index;
+            index *= tables.binomial[d.groupLen[1]][48 - d.groupLen[0]];
+        } else {
+            d.groupIdx[next] = index;
+            index *= tables.binomial[d.groupLen[next]][freeSquares];
+            freeSquares -= d.groupLen[next++];
+        }
+    }
+    d.groupIdx[n] = index;
+}
+
+std::uint8_t setSymlen(PairsData& d, int symbol, std::vector<bool>& visited) {
+    visited[symbol] = true;
+    const int right = rightSymbol(d.btree, symbol);
+    if (right == 0xFFF) {
+        return 0;
+    }
+    const int left = leftSymbol(d.btree, symbol);
+    if (left >= static_cast<int>(d.symlen.size()) || right >= static_cast<int>(d.symlen.size())) {
+        return 0;
+    }
+    if (!visited[left]) {
+        d.symlen[left] = setSymlen(d, left, visited);
+    }
+    if (!visited[right]) {
+        d.symlen[right] = setSymlen(d, right, visited);
+    }
+    return static_cast<std::uint8_t>(d.symlen[left] + d.symlen[right] + 1);
+}
+
+// Reads the Huffman code description; nullptr when it is out of range.
+const std::uint8_t* setSizes(PairsData& d, const std::uint8_t* data) {
+    d.flags = *data++;
+    if (d.flags & SingleValue) {
+        d.minSymLen = *data++;
+        return data;
+    }
+
+    int groups = 0;
+    while (d.groupLen[groups]) {
+        groups++;
+    }
+    const std::uint64_t tableSize = d.groupIdx[groups];
+
+    d.blockSize = std::size_t(1) << data[0];
+    d.span = std::size_t(1) << data[1];
+    d.sparseIndexSize = static_cast<std::size_t>((tableSize + d.span - 1) / d.span);
+    const int padding = data[2];
+    d.blockCount = readLittle32(data + 3);
+    d.blockLengthSize = d.blockCount + padding;
+    d.maxSymLen = data[7];
+    d.minSymLen = data[8];
+    data += 9;
+    if (d.minSymLen < 1 || d.maxSymLen < d.minSymLen || d.maxSymLen > 32) {
+        return nullptr;
+    }
+
+    // Canonical code: longer codes have lower values. base64[l] is the lowest
+    // code of length minSymLen + l, left-aligned in 64 bits, so a code's length
+    // is the first l with buffer >= base64[l].
+    d.lowestSym = data;
+    d.base64.assign(d.maxSymLen - d.minSymLen + 1, 0);
+    for (int i = static_cast<int>(d.base64.size()) - 2; i >= 0; --i) {
+        d.base64[i] = (d.base64[i + 1] + readLittle16(d.lowestSym + 2 * i) -
+                       readLittle16(d.lowestSym + 2 * (i + 1))) / 2;
+    }
+    for (std::size_t i = 0; i < d.base64.size(); ++i) {
+        d.base64[i] <<= 64 - i - d.minSymLen;
+    }
+    data += d.base64.size() * 2;
+
+    d.symlen.assign(readLittle16(data), 0);
+    data += 2;
+    d.btree = data;
+    std::vector<bool> visited(d.symlen.size());
+    for (std::size_t symbol = 0; symbol < d.symlen.size(); ++symbol) {
+        if (!visited[symbol]) {
+            d.symlen[symbol] = setSymlen(d, static_cast<int>(symbol), visited);
+        }
+    }
+    return data + d.symlen.size() * 3 + (d.symlen.size() & 1);
+}
+
+const std::uint8_t* setDtzMap(Table& table, const std::uint8_t* data, int maxFile) {
+    table.dtzMap = data;
+    for (int file = 0; file <= maxFile; ++file) {
+        PairsData& d = table.get(0, file);
+        if (!(d.flags & Mapped)) {
+            continue;
+        }
+        if (d.flags & Wide) {
+            data += (data - table.begin) & 1;
+            for (int i = 0; i < 4; ++i) {
+                d.mapIdx[i] = static_cast<std::uint16_t>((data - table.dtzMap) / 2 + 1);
+                data += 2 * readLittle16(data) + 2;
+            }
+        } else {
+            for (int i = 0; i < 4; ++i) {
+                d.mapIdx[i] = static_cast<std::uint16_t>(data - table.dtzMap + 1);
+                data += *data + 1;
+            }
+        }
+    }
+    return data + ((data - table.begin) & 1);
+}
+
+// Lays the PairsData records over the mapped file, `data` is just past the magic.
+bool setup(Table& table, const std::uint8_t* data) {
+    enum { Split = 1, HasPawns = 2 };
+    if (((*data & HasPawns) != 0) != table.hasPawns || ((*data & Split) != 0) != (table.key != table.key2)) {
+        return false;
+    }
+    data++;
+
+    const int sides = !table.dtz && table.key != table.key2 ? 2 : 1;
+    const int maxFile = table.hasPawns ? 3 : 0;
+    const bool pawnsOnBothSides = table.hasPawns && table.pawnCount[1];
+
+    for (int file = 0; file <= maxFile; ++file) {
+        for (int i = 0; i < sides; ++i) {
+            table.get(i, file) = PairsData();
+        }
+        const int order[2][2] = {
+            {data[0] & 0xF, pawnsOnBothSides ? data[1] & 0xF : 0xF},
+            {data[0] >> 4, pawnsOnBothSides ? data[1] >> 4 : 0xF}
+        };
+        data += pawnsOnBothSides ? 2 : 1;
+        for (int k = 0; k < table.pieceCount; ++k, ++data) {
+            for (int i = 0; i < sides; ++i) {
+                table.get(i, file).pieces[k] = i ? *data >> 4 : *data & 0xF;
+            }
+        }
+        for (int i = 0; i < sides; ++i) {
+            setGroups(table, table.get(i, file), order[i], file);
+        }
+    }
+    data += (data - table.begin) & 1;
+
+    for (int file = 0; file <= maxFile; ++file) {
+        for (int i = 0; i < sides; ++i) {
+            data = setSizes(table.get(i, file), data);
+            if (!data || data > table.end) {
+                return false;
+            }
+        }
+    }
+    if (table.dtz) {
+        data = setDtzMap(table, data, maxFile);
+    }
+
+    for (int file = 0; file <= maxFile; ++file) {
+        for (int i = 0; i < sides; ++i) {
+            PairsData& d = table.get(i, file);
+            d.sparseIndex = data;
+            data += d.sparseIndexSize * 6;
+        }
+    }
+    for (int file = 0; file <= maxFile; ++file) {
+        for (int i = 0; i < sides; ++i) {
+            PairsData& d = table.get(i, file);
+            d.blockLength = data;
+            data += d.blockLengthSize * 2;
+        }
+    }
+    for (int file = 0; file <= maxFile; ++file) {
+        for (int i = 0; i < sides; ++i) {
+            PairsData& d = table.get(i, file);
+            data += (64 - (data - table.begin) % 64) % 64;
+            d.data = data;
+            data += std::size_t(d.blockCount) * d.blockSize;
+        }
+    }
+    return data <= table.end;
+}
+
+// Maps the file on first use; safe to call from several searching threads.
+bool mapTable(Table& table) {
+    if (table.ready.load(std::memory_order_acquire)) {
+        return table.file != nullptr;
+    }
+    Registry& tables = registry();
+    std::lock_guard<std::mutex> lock(tables.mutex);
+    if (table.ready.load(std::memory_order_relaxed)) {
+        return table.file != nullptr;
+    }
+
+    const std::string fileName = table.name + (table.dtz ? ".rtbz" : ".rtbw");
+    for (const std::string& directory : tables.directories) {
+        const std::string path = directory + "/" + fileName;
+        std::unique_ptr<MappedFile> mapped(new MappedFile(path, MappedFile::Access::Random));
+        if (!mapped->isValid()) {
+            continue;
+        }
+        table.begin = reinterpret_cast<const std::uint8_t*>(mapped->data());
+        table.end = table.begin + mapped->size();
+        const std::uint8_t* magic = table.dtz ? DTZ_MAGIC : WDL_MAGIC;
+        if (mapped->size() % 64 == 16 && std::memcmp(table.begin, magic, 4) == 0 && setup(table, table.begin + 4)) {
+            table.file = std::move(mapped);
+        } else {
+            std::cerr << "Corrupt tablebase file: " << path << std::endl;
+        }
+        break;
+    }
+    table.ready.store(true, std::memory_order_release);
+    return table.file != nullptr;
+}
+
+int decompressPairs(const PairsData& d, std::uint64_t index) {
+    if (d.flags & SingleValue) {
+        return d.minSymLen;
+    }
+
+    // The sparse index gives the block and offset of value k * span + span / 2;
+    // walk from there to the block holding `index`.
+    const std::size_t k = static_cast<std::size_t>(index / d.span);
+    if (k >= d.sparseIndexSize) {
+        return 0;
+    }
+    std::uint32_t block = readLittle32(d.sparseIndex + 6 * k);
+    int offset = readLittle16(d.sparseIndex + 6 * k + 4);
+    offset += static_cast<int>(index % d.span) - static_cast<int>(d.span / 2);
+    while (offset < 0) {
+        offset += readLittle16(d.blockLength + 2 * --block) + 1;
+    }
+    while (offset > readLittle16(d.blockLength + 2 * block)) {
+        offset -= readLittle16(d.blockLength + 2 * block++) + 1;
+    }
+
+    const std::uint8_t* bytes = d.data + std::uint64_t(block) * d.blockSize;
+    std::uint64_t buffer = readBig64(bytes);
+    bytes += 8;
+    int bufferSize = 64;
+    int symbol = 0;
+    while (true) {
+        int length = 0;
+        while (buffer < d.base64[length]) {
+            length++;
+        }
+        symbol = static_cast<int>((buffer - d.base64[length]) >> (64 - length - d.minSymLen));
+        symbol += readLittle16(d.lowestSym + 2 * length);
+        if (symbol >= static_cast<int>(d.symlen.size())) {
+            return 0;
+        }
+        if (offset < d.symlen[symbol] + 1) {
+            break;
+        }
+        offset -= d.symlen[symbol] + 1;
+        length += d.minSymLen;
+        buffer <<= length;
+        bufferSize -= length;
+        if (bufferSize <= 32) {
+            bufferSize += 32;
+            buffer |= std::uint64_t(readBig32(bytes)) << (64 - bufferSize);
+            bytes += 4;
+        }
+    }
+
+    // Pairs are expanded left to right, so the offset picks the side.
+    while (d.symlen[symbol]) {
+        const int left = leftSymbol(d.btree, symbol);
+        if (offset < d.symlen[left] + 1) {
+            symbol = left;
+        } else {
+            offset -= d.symlen[left] + 1;
+            symbol = rightSymbol(d.btree, symbol);
+        }
+    }
+    return leftSymbol(d.btree, symbol);
+}
+
+// DTZ values are stored in moves unless the flags say plies, and mapped
+// through a per-result table ordered by frequency.
+int mapDtz(Table& table, int file, int value, Wdl wdl) {
+    static const int WDL_SLOT[] = {1, 3, 0, 2, 0};
+    const PairsData& d = table.get(0, file);
+    if (d.flags & Mapped) {
+        const int at = d.mapIdx[WDL_SLOT[static_cast<int>(wdl) + 2]] + value;
+        value = (d.flags & Wide) ? readLittle16(table.dtzMap + 2 * at) : table.dtzMap[at];
+    }
+    if ((wdl == Wdl::Win && !(d.flags & WinPlies)) || (wdl == Wdl::Loss && !(d.flags & LossPlies)) ||
+        wdl == Wdl::CursedWin || wdl == Wdl::BlessedLoss) {
+        value *= 2;
+    }
+    return value + 1;
+}
+
+// Turns the position into the table's index and decodes the stored value:
+// a Wdl for WDL tables, plies for DTZ tables. Colours are swapped when black
+// has the first half of the file name; squares are mirrored so the leading
+// piece lands in the a1-d1-d4 triangle, or the leading pawn on files a-d.
+int probeTableData(Table& table, const Material& material, int sideToMove, Wdl wdl, ProbeState& state) {
+    const Encoding& tables = encoding();
+    const auto pawnsCompare = [&tables](int a, int b) { return tables.mapPawns[a] < tables.mapPawns[b]; };
+
+    int squares[MAX_PIECES] = {};
+    int pieces[MAX_PIECES] = {};
+    int size = 0;
+    int leadPawnsCount = 0;
+    std::uint64_t leadPawns = 0;
+    int tableFile = 0;
+
+    // Tables with the same material on both sides only store white to move.
+    const bool symmetricBlackToMove = table.key == table.key2 && sideToMove == 1;
+    const bool blackStronger = material.key() != table.key;
+    const bool flip = symmetricBlackToMove || blackStronger;
+    const int flipColor = flip ? 8 : 0;
+    const int flipSquares = flip ? 56 : 0;
+    const int side = (flip ? 1 : 0) ^ sideToMove;
+
+    if (table.hasPawns) {
+        const int leadPawn = table.get(0, 0).pieces[0] ^ flipColor;
+        for (int square = 0; square < 64; ++square) {
+            if (material.pieces[square] == leadPawn) {
+                leadPawns |= bit(square);
+                squares[size++] = square ^ flipSquares;
+            }
+        }
+        leadPawnsCount = size;
+        std::swap(squares[0], *std::max_element(squares, squares + leadPawnsCount, pawnsCompare));
+        tableFile = fileOf(squares[0]) > 3 ? fileOf(squares[0] ^ 7) : fileOf(squares[0]);
+    }
+
+    if (table.dtz && (table.get(side, tableFile).flags & SideToMove) != side &&
+        !(table.key == table.key2 && !table.hasPawns)) {
+        state = ProbeState::ChangeSideToMove;
+        return 0;
+    }
+
+    for (int square = 0; square < 64; ++square) {
+        if (material.pieces[square] && !(leadPawns & bit(square))) {
+            squares[size] = square ^ flipSquares;
+            pieces[size++] = material.pieces[square] ^ flipColor;
+        }
+    }
+
+    // Put the pieces in the order the file lists them.
+    const PairsData& d = table.get(side, tableFile);
+    for (int i = leadPawnsCount; i < size - 1; ++i) {
+        for (int j = i + 1; j < size; ++j) {
+            if (d.pieces[i] == pieces[j]) {
+                std::swap(pieces[i], pieces[j]);
+                std::swap(squares[i], squares[j]);
+                break;
+            }
+        }
+    }
+
+    if (fileOf(squares[0]) > 3) {
+        for (int i = 0; i < size; ++i) {
+            squares[i] ^= 7;
+        }
+    }
+
+    std::uint64_t index = 0;
+    if (table.hasPawns) {
+        index = tables.leadPawnIdx[leadPawnsCount][squares[0]];
+        std::stable_sort(squares + 1, squares + leadPawnsCount, pawnsCompare);
+        for (int i = 1; i < leadPawnsCount; ++i) {
+            index += tables.binomial[i][tables.mapPawns[squares[i]]];
+        }
+    } else {
+        if (rankOf(squares[0]) > 3) {
+            for (int i = 0; i < size; ++i) {
+                squares[i] ^= 56;
+            }
+        }
+        // The first leading piece off the a1-h8 diagonal must end up below it.
+        for (int i = 0; i < d.groupLen[0]; ++i) {
+            if (!offDiagonal(squares[i])) {
+                continue;
+            }
+            if (offDiagonal(squares[i]) > 0) {
+                for (int j = i; j < size; ++j) {
+                    squares[j] = flipDiagonal(squares[j]);
+                }
+            }
+            break;
+        }
+
+        if (table.hasUniquePieces) {
+            const int adjust1 = squares[1] > squares[0];
+            const int adjust2 = (squares[2] > squares[0]) + (squares[2] > squares[1]);
+            if (offDiagonal(squares[0])) {
+                index = (tables.mapA1D1D4[squares[0]] * 63 + (squares[1] - adjust1)) * 62 + squares[2] - adjust2;
+            } else if (offDiagonal(squares[1])) {
+                index = (6 * 63 + rankOf(squares[0]) * 28 + tables.mapB1H1H7[squares[1]]) * 62 +
+                        squares[2] - adjust2;
+            } else if (offDiagonal(squares[2])) {
+                index = 6 * 63 * 62 + 4 * 28 * 62 + rankOf(squares[0]) * 7 * 28 +
+                        (rankOf(squares[1]) - adjust1) * 28 + tables.mapB1H1H7[squares[2]];
+            } else {
+                index = 6 * 63 * 62 + 4 * 28 * 62 + 4 * 7 * 28 + rankOf(squares[0]) * 7 * 6 +
+                        (rankOf(squares[1]) - adjust1) * 6 + (rankOf(squares[2]) - adjust2);
+            }
+        } else {
+            index = tables.mapKK[tables.mapA1D1D4[squares[0]]][squares[1]];
+        }
+    }
+
+    // Every other group is a combination of squares, skipping the squares
+    // already taken by earlier groups.
+    index *= d.groupIdx[0];
+    int* group = squares + d.groupLen[0];
+    bool remainingPawns = table.hasPawns && table.pawnCount[1];
+    for (int next = 1; d.groupLen[next]; ++next) {
+        std::stable_sort(group, group + d.groupLen[next]);
+        std::uint64_t combination = 0;
+        for (int i = 0; i < d.groupLen[next]; ++i) {
+            const int taken = static_cast<int>(std::count_if(squares, group, [&](int square) {
+                return group[i] > square;
+            }));
+            combination += tables.binomial[i + 1][group[i] - taken - (remainingPawns ? 8 : 0)];
+        }
+        remainingPawns = false;
+        index += combination * d.groupIdx[next];
+        group += d.groupLen[next];
+    }
+
+    const int value = decompressPairs(d, index);
+    return table.dtz ? mapDtz(table, tableFile, value, wdl) : value - 2;
+}
+
+int probeTable(const Board* board, Piece::Color color, bool dtz, Wdl wdl, ProbeState& state) {
+    const Material material(board);
+    if (material.total == 2) {
+        return 0;
+    }
+    Registry& tables = registry();
+    const auto found = tables.byKey.find(material.key());
+    Table* table = found == tables.byKey.end() ? nullptr : dtz ? found->second.second : found->second.first;
+    if (!table || !mapTable(*table)) {
+        state = ProbeState::Fail;
+        return 0;
+    }
+    return probeTableData(*table, material, color == Piece::Color::White ? 0 : 1, wdl, state);
+}
+
+Piece::Color opposite(Piece::Color color) {
+    return color == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
+}
+
+bool isCapture(const Board* board, const Move& move) {
+    return move.getType() == Move::Type::EnPassant || board->getSquare(move.getTo())->isOccupied();
+}
+
+bool isPawnMove(const Board* board, const Move& move) {
+    return board->getSquare(move.getFrom())->getPiece()->getType() == Piece::Type::Pawn;
+}
+
+int signOf(int value) {
+    return (0 < value) - (value < 0);
+}
+
+// The plies a zeroing move "costs" in a position with result `wdl`.
+int dtzBeforeZeroing(Wdl wdl) {
+    switch (wdl) {
+        case Wdl::Win: return 1;
+        case Wdl::CursedWin: return 101;
+        case Wdl::BlessedLoss: return -101;
+        case Wdl::Loss: return -1;
+        default: return 0;
+    }
+}
+
+// The generator leaves positions with a winning capture as "don't care", so
+// captures (and for DTZ, pawn moves) are searched and the best of them is
+// combined with the stored value. Positions with an en passant square are
+// not in the tables either, which the capture search also covers.
+Wdl search(const Board* board, Piece::Color color, bool pawnMovesZero, ProbeState& state) {
+    Wdl best = Wdl::Loss;
+    const std::vector<Move> moves = MoveGenerator::generateAllMoves(board, color);
+    std::size_t tried = 0;
+    Board next(*board);
+    for (const Move& move : moves) {
+        if (!isCapture(board, move) && (!pawnMovesZero || !isPawnMove(board, move))) {
+            continue;
+        }
+        tried++;
+        next = *board;
+        next.applyMove(move);
+        const Wdl value = static_cast<Wdl>(-static_cast<int>(search(&next, opposite(color), false, state)));
+        if (state == ProbeState::Fail) {
+            return Wdl::Draw;
+        }
+        if (value > best) {
+            best = value;
+            if (value >= Wdl::Win) {
+                state = ProbeState::ZeroingBestMove;
+                return value;
+            }
+        }
+    }
+
+    const bool noMoreMoves = tried && tried == moves.size();
+    Wdl value = best;
+    if (!noMoreMoves) {
+        value = static_cast<Wdl>(probeTable(board, color, false, Wdl::Draw, state));
+        if (state == ProbeState::Fail) {
+            return Wdl::Draw;
+        }
+    }
+    if (best >= value) {
+        state = best > Wdl::Draw || noMoreMoves ? ProbeState::ZeroingBestMove : ProbeState::Ok;
+        return best;
+    }
+    state = ProbeState::Ok;
+    return value;
+}
+
+int probeDtz(const Board* board, Piece::Color color, ProbeState& state) {
+    state = ProbeState::Ok;
+    const Wdl wdl = search(board, color, true, state);
+    if (state == ProbeState::Fail || wdl == Wdl::Draw) {
+        return 0;
+    }
+    if (state == ProbeState::ZeroingBestMove) {
+        return dtzBeforeZeroing(wdl);
+    }
+
+    int dtz = probeTable(board, color, true, wdl, state);
+    if (state == ProbeState::Fail) {
+        return 0;
+    }
+    if (state != ProbeState::ChangeSideToMove) {
+        return (dtz + (wdl == Wdl::BlessedLoss || wdl == Wdl::CursedWin ? 100 : 0)) * signOf(static_cast<int>(wdl));
+    }
+
+    // Only the other side to move is stored: take the best reply one ply down.
+    const Piece::Color opponent = opposite(color);
+    int minDtz = 0xFFFF;
+    Board next(*board);
+    for (const Move& move : MoveGenerator::generateAllMoves(board, color)) {
+        const bool zeroing = isCapture(board, move) || isPawnMove(board, move);
+        next = *board;
+        next.applyMove(move);
+        dtz = zeroing ? -dtzBeforeZeroing(search(&next, opponent, false, state))
+                      : -probeDtz(&next, opponent, state);
+        if (dtz == 1 && next.isCheckmate(opponent)) {
+            minDtz = 1;
+        }
+        if (!zeroing) {
+            dtz += signOf(dtz);
+        }
+        if (dtz < minDtz && signOf(dtz) == signOf(static_cast<int>(wdl))) {
+            minDtz = dtz;
+        }
+        if (state == ProbeState::Fail) {
+            return 0;
+        }
+    }
+    return minDtz == 0xFFFF ? -1 : minDtz;
+}
+
+// Board keeps its rights when built square by square, so a right only counts
+// while the king and that rook are still at home.
+bool canCastle(const Board* board) {
+    const struct {
+        Board::CastlingRight right;
+        int king;
+        int rook;
+        Piece::Color color;
+    } rights[] = {
+        {Board::WhiteKingside, 4, 7, Piece::Color::White},
+        {Board::WhiteQueenside, 4, 0, Piece::Color::White},
+        {Board::BlackKingside, 60, 63, Piece::Color::Black},
+        {Board::BlackQueenside, 60, 56, Piece::Color::Black}
+    };
+    for (const auto& castling : rights) {
+        const Piece* king = board->getSquareAt(castling.king).getPiece();
+        const Piece* rook = board->getSquareAt(castling.rook).getPiece();
+        if (board->hasCastlingRight(castling.right) &&
+            king && king->getType() == Piece::Type::King && king->getColor() == castling.color &&
+            rook && rook->getType() == Piece::Type::Rook && rook->getColor() == castling.color) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Checked before searching captures, which costs a move generation per node.
+bool probeable(const Board* board) {
+    const Registry& tables = registry();
+    if (!board || tables.maxPieces == 0 || canCastle(board)) {
+        return false;
+    }
+    const Material material(board);
+    return material.total <= tables.maxPieces && tables.byKey.count(material.key()) > 0;
+}
+}
+
+int Syzygy::init(const std::string& paths) {
+    Registry& tables = registry();
+    std::lock_guard<std::mutex> lock(tables.mutex);
+    tables.byKey.clear();
+    tables.tables.clear();
+    tables.directories.clear();
+    tables.maxPieces = 0;
+    if (paths.empty() || paths == "<empty>") {
+        return 0;
+    }
+
+#ifdef _WIN32
+    const char separator = ';';
+#else
+    const char separator = ':';
+#endif
+    std::istringstream stream(paths);
+    std::string directory;
+    while (std::getline(stream, directory, separator)) {
+        if (!directory.empty()) {
+            tables.directories.push_back(directory);
+        }
+    }
+
+    int found = 0;
+    for (const std::string& path : tables.directories) {
+        std::error_code error;
+        for (std::filesystem::directory_iterator entry(path, error), end; !error && entry != end;
+             entry.increment(error)) {
+            if (entry->path().extension() != ".rtbw") {
+                continue;
+            }
+            const std::string name = entry->path().stem().string();
+            int counts[2][6] = {};
+            if (!parseName(name, counts) || tables.byKey.count(materialKey(counts, false))) {
+                continue;
+            }
+
+            std::unique_ptr<Table> wdl(new Table());
+            std::unique_ptr<Table> dtz(new Table());
+            describe(*wdl, name, counts, false);
+            describe(*dtz, name, counts, true);
+            const std::pair<Table*, Table*> pair(wdl.get(), dtz.get());
+            tables.byKey[wdl->key] = pair;
+            tables.byKey[wdl->key2] = pair;
+            tables.maxPieces = std::max(tables.maxPieces, wdl->pieceCount);
+            tables.tables.push_back(std::move(wdl));
+            tables.tables.push_back(std::move(dtz));
+            found++;
+        }
+    }
+    return found;
+}
+
+int Syzygy::maxPieces() {
+    return registry().maxPieces;
+}
+
+bool Syzygy::probeWdl(const Board* board, Piece::Color color, Wdl& result) {
+    PROFILE_SCOPE("Syzygy::probeWdl");
+    if (!probeable(board)) {
+        return false;
+    }
+    ProbeState state = ProbeState::Ok;
+    result = search(board, color, false, state);
+    return state != ProbeState::Fail;
+}
+
+bool Syzygy::probeDtz(const Board* board, Piece::Color color, int& dtz) {
+    PROFILE_SCOPE("Syzygy::probeDtz");
+    if (!probeable(board)) {
+        return false;
+    }
+    ProbeState state = ProbeState::Ok;
+    dtz = ::probeDtz(board, color, state);
+    return state != ProbeState::Fail;
+}
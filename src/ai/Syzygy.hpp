@@ -0,0 +1,34 @@
+#pragma once
+#include "board/Board.hpp"
+#include <cstdint>
+#include <string>
+
+// Reader for Syzygy WDL (.rtbw) and DTZ (.rtbz) endgame tables. init() only
+// records which tables exist; a file is memory-mapped on its first probe.
+// Positions where a side can still castle are not in the tables.
+class Syzygy {
+public:
+    // Cursed wins and blessed losses are decided by the fifty-move rule.
+    enum class Wdl : std::int8_t {
+        Loss = -2,
+        BlessedLoss = -1,
+        Draw = 0,
+        CursedWin = 1,
+        Win = 2
+    };
+
+    static const int MAX_PIECES = 7;
+
+    // Directories are separated by ':' (';' on Windows); an empty string or
+    // "<empty>" unloads everything. Returns the number of WDL tables found.
+    static int init(const std::string& paths);
+    // Largest piece count, kings included, that a loaded table covers.
+    static int maxPieces();
+
+    // Both results are for `color` to move; false when no table covers the position.
+    static bool probeWdl(const Board* board, Piece::Color color, Wdl& result);
+    // Plies to the next capture or pawn move with best play, counted from a
+    // zero fifty-move counter: positive when winning, negative when losing,
+    // 0 for a draw. Beyond +-100 the result is a cursed win or blessed loss.
+    static bool probeDtz(const Board* board, Piece::Color color, int& dtz);
+};
@@ -0,0 +1,282 @@
+#include "Tablebase.hpp"
+#include "utils/Profiler.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+using Bitboard = std::uint64_t;
+
+const int KPK_INDEX_COUNT = 2 * 24 * 64 * 64;
+
+enum KpkResult : std::uint8_t {
+    Invalid = 0,
+    Unknown = 1,
+    Draw = 2,
+    Win = 4
+};
+
+int fileOf(int square) { return square & 7; }
+int rankOf(int square) { return square >> 3; }
+Bitboard bit(int square) { return Bitboard(1) << square; }
+
+int popLowest(Bitboard& bits) {
+    int square = 0;
+    while (!((bits >> square) & 1)) {
+        square++;
+    }
+    bits &= bits - 1;
+    return square;
+}
+
+int distance(int a, int b) {
+    return std::max(std::abs(fileOf(a) - fileOf(b)), std::abs(rankOf(a) - rankOf(b)));
+}
+
+Bitboard stepAttacks(int square, const int (*steps)[2], int count) {
+    Bitboard attacks = 0;
+    for (int i = 0; i < count; ++i) {
+        const int file = fileOf(square) + steps[i][0];
+        const int rank = rankOf(square) + steps[i][1];
+        if (file >= 0 && file < 8 && rank >= 0 && rank < 8) {
+            attacks |= bit(rank * 8 + file);
+        }
+    }
+    return attacks;
+}
+
+Bitboard kingAttacks(int square) {
+    static const int steps[8][2] = {{-1, -1}, {0, -1}, {1, -1}, {-1, 0}, {1, 0}, {-1, 1}, {0, 1}, {1, 1}};
+    return stepAttacks(square, steps, 8);
+}
+
+// White pawn; the bitbase is always built from white's side.
+Bitboard pawnAttacks(int square) {
+    static const int steps[2][2] = {{-1, 1}, {1, 1}};
+    return stepAttacks(square, steps, 2);
+}
+
+Bitboard slidingAttacks(int square, Bitboard occupied, bool straight, bool diagonal) {
+    static const int directions[8][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+    Bitboard attacks = 0;
+    for (int d = straight ? 0 : 4; d < (diagonal ? 8 : 4); ++d) {
+        int file = fileOf(square) + directions[d][0];
+        int rank = rankOf(square) + directions[d][1];
+        while (file >= 0 && file < 8 && rank >= 0 && rank < 8) {
+            attacks |= bit(rank * 8 + file);
+            if (occupied & bit(rank * 8 + file)) {
+                break;
+            }
+            file += directions[d][0];
+            rank += directions[d][1];
+        }
+    }
+    return attacks;
+}
+
+// Pawn on files a-d, ranks 2-7; side 0 is white (the pawn's side) to move.
+int kpkIndex(int side, int blackKing, int whiteKing, int pawn) {
+    return whiteKing | (blackKing << 6) | (side << 12) | (fileOf(pawn) << 13) | ((6 - rankOf(pawn)) << 15);
+}
+
+KpkResult classifyInitial(int index) {
+    const int whiteKing = index & 63;
+    const int blackKing = (index >> 6) & 63;
+    const int side = (index >> 12) & 1;
+    const int pawn = (6 - (index >> 15)) * 8 + ((index >> 13) & 3);
+
+    if (distance(whiteKing, blackKing) <= 1 || whiteKing == pawn || blackKing == pawn ||
+        (side == 0 && (pawnAttacks(pawn) & bit(blackKing)))) {
+        return Invalid;
+    }
+
+    const int queening = pawn + 8;
+    if (side == 0 && rankOf(pawn) == 6 && whiteKing != queening && blackKing != queening &&
+        (distance(blackKing, queening) > 1 || distance(whiteKing, queening) == 1)) {
+        return Win;
+    }
+
+    if (side == 1) {
+        const Bitboard escapes = kingAttacks(blackKing) & ~(kingAttacks(whiteKing) | pawnAttacks(pawn));
+        if (!escapes || (kingAttacks(blackKing) & bit(pawn) & ~kingAttacks(whiteKing))) {
+            return Draw;
+        }
+    }
+    return Unknown;
+}
+
+KpkResult classify(const std::vector<std::uint8_t>& table, int index) {
+    const int whiteKing = index & 63;
+    const int blackKing = (index >> 6) & 63;
+    const int side = (index >> 12) & 1;
+    const int pawn = (6 - (index >> 15)) * 8 + ((index >> 13) & 3);
+
+    const KpkResult good = side == 0 ? Win : Draw;
+    const KpkResult bad = side == 0 ? Draw : Win;
+
+    std::uint8_t result = Invalid;
+    Bitboard moves = kingAttacks(side == 0 ? whiteKing : blackKing);
+    while (moves) {
+        const int to = popLowest(moves);
+        result |= side == 0 ? table[kpkIndex(1, blackKing, to, pawn)]
+                            : table[kpkIndex(0, to, whiteKing, pawn)];
+    }
+
+    if (side == 0) {
+        if (rankOf(pawn) < 6) {
+            result |= table[kpkIndex(1, blackKing, whiteKing, pawn + 8)];
+        }
+        if (rankOf(pawn) == 1 && pawn + 8 != whiteKing && pawn + 8 != blackKing) {
+            result |= table[kpkIndex(1, blackKing, whiteKing, pawn + 16)];
+        }
+    }
+
+    return (result & good) ? good : (result & Unknown) ? Unknown : bad;
+}
+
+const std::vector<std::uint8_t>& kpkTable() {
+    static const std::vector<std::uint8_t> table = [] {
+        std::vector<std::uint8_t> db(KPK_INDEX_COUNT);
+        for (int index = 0; index < KPK_INDEX_COUNT; ++index) {
+            db[index] = classifyInitial(index);
+        }
+
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (int index = 0; index < KPK_INDEX_COUNT; ++index) {
+                if (db[index] == Unknown) {
+                    db[index] = classify(db, index);
+                    changed |= db[index] != Unknown;
+                }
+            }
+        }
+        return db;
+    }();
+    return table;
+}
+
+struct Material {
+    int kings[2] = {-1, -1};
+    int piece = -1;
+    int count = 0;
+};
+
+int colorIndex(Piece::Color color) {
+    return color == Piece::Color::White ? 0 : 1;
+}
+
+// KQK / KRK: lost for the defender unless it can take the piece or is stalemated.
+Tablebase::Wdl probeHeavyPiece(const Material& material, bool straight, bool diagonal, int strong, int toMove) {
+    if (toMove == strong) {
+        return Tablebase::Wdl::Win;
+    }
+
+    const int strongKing = material.kings[strong];
+    const int weakKing = material.kings[1 - strong];
+    const Bitboard occupied = bit(strongKing) | bit(material.piece);
+    const Bitboard pieceAttacks = slidingAttacks(material.piece, occupied, straight, diagonal);
+    const Bitboard escapes = kingAttacks(weakKing) & ~kingAttacks(strongKing) & ~pieceAttacks;
+
+    if ((escapes & bit(material.piece)) || (!escapes && !(pieceAttacks & bit(weakKing)))) {
+        return Tablebase::Wdl::Draw;
+    }
+    return Tablebase::Wdl::Loss;
+}
+
+Tablebase::Wdl probeKpk(const Material& material, int strong, int toMove) {
+    // Normalise to a white pawn on files a-d.
+    const int flip = strong == 0 ? 0 : 56;
+    int whiteKing = material.kings[strong] ^ flip;
+    int blackKing = material.kings[1 - strong] ^ flip;
+    int pawn = material.piece ^ flip;
+    if (fileOf(pawn) > 3) {
+        whiteKing ^= 7;
+        blackKing ^= 7;
+        pawn ^= 7;
+    }
+
+    const int side = toMove == strong ? 0 : 1;
+    if (kpkTable()[kpkIndex(side, blackKing, whiteKing, pawn)] != Win) {
+        return Tablebase::Wdl::Draw;
+    }
+    return side == 0 ? Tablebase::Wdl::Win : Tablebase::Wdl::Loss;
+}
+}
+
+int Tablebase::setSyzygyPath(const std::string& paths) {
+    return Syzygy::init(paths);
+}
+
+int Tablebase::pieceCount(const Board* board) {
+    int count = 0;
+    for (int index = 0; index < Board::SQUARE_COUNT; ++index) {
+        if (board->getSquareAt(index).isOccupied()) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool Tablebase::probeWdl(const Board* board, Piece::Color color, Wdl& result) {
+    PROFILE_SCOPE("Tablebase::probeWdl");
+    if (!board) {
+        return false;
+    }
+
+    Syzygy::Wdl syzygy;
+    if (Syzygy::probeWdl(board, color, syzygy)) {
+        result = syzygy == Syzygy::Wdl::Win ? Wdl::Win : syzygy == Syzygy::Wdl::Loss ? Wdl::Loss : Wdl::Draw;
+        return true;
+    }
+
+    Material material;
+    for (int index = 0; index < Board::SQUARE_COUNT; ++index) {
+        const Square& square = board->getSquareAt(index);
+        if (!square.isOccupied()) {
+            continue;
+        }
+        if (++material.count > BUILTIN_PIECES) {
+            return false;
+        }
+        const Piece* piece = square.getPiece();
+        if (piece->getType() == Piece::Type::King) {
+            material.kings[colorIndex(piece->getColor())] = index;
+        } else {
+            material.piece = index;
+        }
+    }
+    if (material.kings[0] < 0 || material.kings[1] < 0) {
+        return false;
+    }
+
+    result = Wdl::Draw;
+    if (material.piece < 0) {
+        return true;
+    }
+
+    const Piece& piece = *board->getSquareAt(material.piece).getPiece();
+    const int strong = colorIndex(piece.getColor());
+    const int toMove = colorIndex(color);
+    switch (piece.getType()) {
+        case Piece::Type::Pawn:
+            if (rankOf(material.piece) == 0 || rankOf(material.piece) == 7) {
+                return false;
+            }
+            result = probeKpk(material, strong, toMove);
+            break;
+        case Piece::Type::Queen:
+            result = probeHeavyPiece(material, true, true, strong, toMove);
+            break;
+        case Piece::Type::Rook:
+            result = probeHeavyPiece(material, true, false, strong, toMove);
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+bool Tablebase::probeDtz(const Board* board, Piece::Color color, int& dtz) {
+    return Syzygy::probeDtz(board, color, dtz);
+}
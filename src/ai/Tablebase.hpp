@@ -0,0 +1,32 @@
+#pragma once
+#include "board/Board.hpp"
+#include "ai/Syzygy.hpp"
+#include <cstdint>
+#include <string>
+
+// Exact win/draw/loss for endgames. Syzygy tables are used when a path is set;
+// otherwise, and for material they do not cover, positions with at most
+// BUILTIN_PIECES pieces (kings included) are solved in process: KPK from a
+// bitbase built by retrograde analysis on first use, KQK and KRK from the few
+// positions where the defender escapes.
+class Tablebase {
+public:
+    enum class Wdl : std::int8_t {
+        Loss = -1,
+        Draw = 0,
+        Win = 1
+    };
+
+    static const int MAX_PIECES = Syzygy::MAX_PIECES;
+    static const int BUILTIN_PIECES = 3;
+
+    // Loads the Syzygy tables under `paths`, see Syzygy::init. Returns the number found.
+    // Not exposed as a UCI option until the reader is tested against real table files.
+    static int setSyzygyPath(const std::string& paths);
+    static int pieceCount(const Board* board);
+    // Result for `color` to move; false when the material is not covered. Cursed
+    // wins and blessed losses are draws, the search does not track the fifty-move counter.
+    static bool probeWdl(const Board* board, Piece::Color color, Wdl& result);
+    // Syzygy distance to zeroing for `color` to move; false without a Syzygy table.
+    static bool probeDtz(const Board* board, Piece::Color color, int& dtz);
+};
@@ -0,0 +1,241 @@
+#include "BatchAnalyzer.hpp"
+#include "board/Board.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+bool isNumber(const std::string& text) {
+    return !text.empty() && std::all_of(text.begin(), text.end(),
+                                        [](unsigned char c) { return std::isdigit(c); });
+}
+
+std::string quoteCsv(const std::string& text) {
+    if (text.find_first_of(",\"\n") == std::string::npos) {
+        return text;
+    }
+    std::string quoted = "\"";
+    for (char c : text) {
+        quoted += c;
+        if (c == '"') quoted += '"';
+    }
+    return quoted + "\"";
+}
+
+std::string quoteJson(const std::string& text) {
+    std::string quoted = "\"";
+    for (char c : text) {
+        switch (c) {
+            case '"':  quoted += "\\\""; break;
+            case '\\': quoted += "\\\\"; break;
+            case '\n': quoted += "\\n"; break;
+            case '\r': quoted += "\\r"; break;
+            case '\t': quoted += "\\t"; break;
+            case '\b': quoted += "\\b"; break;
+            case '\f': quoted += "\\f"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[7];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+                    quoted += escaped;
+                } else {
+                    quoted += c;
+                }
+        }
+    }
+    return quoted + "\"";
+}
+
+// Bounded so a multi-million line file is streamed rather than loaded.
+class JobQueue {
+public:
+    explicit JobQueue(std::size_t capacity) : capacity(capacity), closed(false) {}
+
+    void push(std::size_t line, std::string text) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [this] { return jobs.size() < capacity; });
+        jobs.emplace_back(line, std::move(text));
+        notEmpty.notify_one();
+    }
+
+    bool pop(std::pair<std::size_t, std::string>& job) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this] { return closed || !jobs.empty(); });
+        if (jobs.empty()) {
+            return false;
+        }
+        job = std::move(jobs.front());
+        jobs.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        notEmpty.notify_all();
+    }
+
+private:
+    std::size_t capacity;
+    bool closed;
+    std::deque<std::pair<std::size_t, std::string>> jobs;
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+};
+}
+
+BatchAnalyzer::BatchAnalyzer(const Options& options) : options(options) {
+}
+
+std::size_t BatchAnalyzer::run(std::istream& input, std::ostream& output) const {
+    const unsigned int hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t threadCount = options.threads > 0 ? options.threads : hardwareThreads;
+
+    JobQueue queue(threadCount * 64);
+    std::mutex outputMutex;
+    std::size_t analysed = 0;
+
+    writeHeader(output, options.format);
+
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        workers.emplace_back([&] {
+            AI ai;
+            ai.setDepth(searchDepth());
+            ai.setTimeLimit(std::chrono::milliseconds(options.moveTime));
+
+            std::pair<std::size_t, std::string> job;
+            while (queue.pop(job)) {
+                Result result;
+                const bool ok = analyse(ai, job.first, job.second, result);
+
+                std::lock_guard<std::mutex> lock(outputMutex);
+                if (ok) {
+                    writeResult(output, options.format, result);
+                    analysed++;
+                } else {
+                    std::cerr << "Skipping line " << job.first << ": invalid position\n";
+                }
+            }
+        });
+    }
+
+    std::string text;
+    std::size_t line = 0;
+    while (std::getline(input, text)) {
+        line++;
+        if (text.find_first_not_of(" \t\r") == std::string::npos || text[0] == '#') {
+            continue;
+        }
+        queue.push(line, text);
+    }
+    queue.close();
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    output.flush();
+    return analysed;
+}
+
+int BatchAnalyzer::searchDepth() const {
+    if (options.depth > 0) {
+        return options.depth;
+    }
+    return options.moveTime > 0 ? MAX_DEPTH : DEFAULT_DEPTH;
+}
+
+bool BatchAnalyzer::analyse(const AI& ai, std::size_t line, const std::string& text, Result& result) const {
+    Board board;
+    Piece::Color sideToMove = Piece::Color::White;
+    if (!parseLine(text, result.fen, result.id) || !board.setupFromFEN(result.fen, sideToMove)) {
+        return false;
+    }
+    result.line = line;
+    if (result.id.empty()) {
+        result.id = std::to_string(line);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    result.search = ai.search(&board, sideToMove);
+    result.timeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+bool BatchAnalyzer::parseLine(const std::string& line, std::string& fen, std::string& id) {
+    std::istringstream stream(line);
+    std::vector<std::string> fields;
+    std::string field;
+    while (fields.size() < 6 && stream >> field) {
+        fields.push_back(field);
+    }
+    if (fields.size() < 4) {
+        return false;
+    }
+
+    const bool isFen = fields.size() == 6 && isNumber(fields[4]) && isNumber(fields[5]);
+    const std::size_t fieldCount = isFen ? 6 : 4;
+    fen.clear();
+    for (std::size_t i = 0; i < fieldCount; ++i) {
+        fen += (i ? " " : "") + fields[i];
+    }
+
+    id.clear();
+    const std::size_t idStart = line.find("id \"");
+    if (!isFen && idStart != std::string::npos) {
+        const std::size_t valueStart = idStart + 4;
+        const std::size_t valueEnd = line.find('"', valueStart);
+        if (valueEnd != std::string::npos) {
+            id = line.substr(valueStart, valueEnd - valueStart);
+        }
+    }
+    return true;
+}
+
+void BatchAnalyzer::writeHeader(std::ostream& output, Format format) {
+    if (format == Format::Csv) {
+        output << "line,id,fen,bestmove,score_cp,mate,depth,nodes,time_ms,pv\n";
+    }
+}
+
+void BatchAnalyzer::writeResult(std::ostream& output, Format format, const Result& result) {
+    const Move& move = result.search.move;
+    const std::string bestMove = move.getFrom().isValid() ? move.toAlgebraic() : "0000";
+    std::string pv;
+    if (!result.search.lines.empty()) {
+        for (const Move& pvMove : result.search.lines.front().pv) {
+            pv += (pv.empty() ? "" : " ") + pvMove.toAlgebraic();
+        }
+    }
+
+    // As in UCI: exactly one of the two is set, the other is empty (CSV) or null (JSON).
+    const int score = result.search.score;
+    const bool mate = AI::isMateScore(score);
+    const std::string scoreCp = mate ? "" : std::to_string(AI::toCentipawns(score));
+    const std::string mateIn = mate ? std::to_string(AI::mateInMoves(score)) : "";
+
+    if (format == Format::Csv) {
+        output << result.line << ',' << quoteCsv(result.id) << ',' << result.fen << ','
+               << bestMove << ',' << scoreCp << ',' << mateIn << ',' << result.search.depth << ','
+               << result.search.stats.nodes << ',' << result.timeMs << ',' << pv << '\n';
+    } else {
+        output << "{\"line\":" << result.line << ",\"id\":" << quoteJson(result.id)
+               << ",\"fen\":" << quoteJson(result.fen) << ",\"bestmove\":" << quoteJson(bestMove)
+               << ",\"score_cp\":" << (mate ? "null" : scoreCp) << ",\"mate\":" << (mate ? mateIn : "null")
+               << ",\"depth\":" << result.search.depth
+               << ",\"nodes\":" << result.search.stats.nodes << ",\"time_ms\":" << result.timeMs
+               << ",\"pv\":" << quoteJson(pv) << "}\n";
+    }
+}
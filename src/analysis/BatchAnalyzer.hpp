@@ -0,0 +1,52 @@
+#pragma once
+#include "ai/AI.hpp"
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+// Streams FEN/EPD lines through a pool of workers, one AI per worker, and
+// writes one CSV row or JSON object per position as soon as it is done.
+// Rows are not in input order; the line column identifies the position.
+// Scores are reported like UCI: centipawns, or moves to mate.
+class BatchAnalyzer {
+public:
+    enum class Format {
+        Csv,
+        Jsonl
+    };
+
+    static const int DEFAULT_DEPTH = 3;
+    static const int MAX_DEPTH = 64;
+
+    struct Options {
+        // 0 picks DEFAULT_DEPTH, or MAX_DEPTH when only moveTime bounds the search.
+        int depth = 0;
+        int moveTime = 0;
+        int threads = 0;
+        Format format = Format::Csv;
+    };
+
+    struct Result {
+        std::size_t line = 0;
+        std::string id;
+        std::string fen;
+        AI::SearchResult search;
+        long long timeMs = 0;
+    };
+
+    explicit BatchAnalyzer(const Options& options);
+
+    // Returns the number of positions analysed; unparsable lines are reported on std::cerr.
+    std::size_t run(std::istream& input, std::ostream& output) const;
+
+    // Splits a FEN or EPD line into a FEN and the EPD "id" operation, if any.
+    static bool parseLine(const std::string& line, std::string& fen, std::string& id);
+    static void writeHeader(std::ostream& output, Format format);
+    static void writeResult(std::ostream& output, Format format, const Result& result);
+
+private:
+    Options options;
+
+    int searchDepth() const;
+    bool analyse(const AI& ai, std::size_t line, const std::string& text, Result& result) const;
+};
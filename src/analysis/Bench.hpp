@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// Fixed regression workload: every position is searched to the same depth by
+// one seeded AI on one thread, so the node total changes only when search
+// behaviour does, while nodes per second tracks speed.
+class Bench {
+public:
+    struct Result {
+        std::size_t positions = 0;
+        std::uint64_t nodes = 0;
+        long long timeMs = 0;
+        std::uint64_t nodesPerSecond = 0;
+    };
+
+    static const int DEFAULT_DEPTH = 2;
+    static const unsigned int SEED = 20240601;
+
+    static const std::vector<std::string>& positions();
+    static Result run(std::ostream& output, int depth = DEFAULT_DEPTH);
+};
@@ -0,0 +1,197 @@
+#include "MatchRunner.hpp"
+#include "ai/AI.hpp"
+#include "board/Board.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+namespace {
+const char* const START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+double scoreToElo(double score) {
+    if (score <= 0.0) return -std::numeric_limits<double>::infinity();
+    if (score >= 1.0) return std::numeric_limits<double>::infinity();
+    return 400.0 * std::log10(score / (1.0 - score));
+}
+
+double eloToScore(double elo) {
+    return 1.0 / (1.0 + std::pow(10.0, -elo / 400.0));
+}
+
+double scoreVariance(const MatchStats& stats) {
+    const double n = static_cast<double>(stats.games());
+    const double s = stats.score();
+    return (stats.wins * (1.0 - s) * (1.0 - s) + stats.draws * (0.5 - s) * (0.5 - s) +
+            stats.losses * s * s) / n;
+}
+
+void configure(AI& ai, const MatchRunner::Engine& engine) {
+    ai.setDepth(engine.depth);
+    ai.setTimeLimit(std::chrono::milliseconds(engine.moveTime));
+}
+}
+
+double MatchStats::score() const {
+    const std::size_t n = games();
+    return n == 0 ? 0.5 : (wins + 0.5 * draws) / n;
+}
+
+double MatchStats::eloDifference() const {
+    return scoreToElo(score());
+}
+
+double MatchStats::eloError() const {
+    const std::size_t n = games();
+    if (n == 0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    const double margin = 1.96 * std::sqrt(scoreVariance(*this) / n);
+    return (scoreToElo(score() + margin) - scoreToElo(score() - margin)) / 2.0;
+}
+
+double MatchStats::logLikelihoodRatio(double elo0, double elo1) const {
+    const std::size_t n = games();
+    if (n == 0) {
+        return 0.0;
+    }
+    const double variance = scoreVariance(*this);
+    if (variance <= 0.0) {
+        return 0.0;
+    }
+    const double s0 = eloToScore(elo0);
+    const double s1 = eloToScore(elo1);
+    return n * (s1 - s0) * (2.0 * score() - s0 - s1) / (2.0 * variance);
+}
+
+MatchRunner::MatchRunner(const Options& options) : options(options) {
+}
+
+MatchRunner::Result MatchRunner::run(const std::vector<std::string>& openings) const {
+    const unsigned int hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t threadCount = options.threads > 0 ? options.threads : hardwareThreads;
+
+    std::atomic<std::size_t> nextGame(0);
+    std::atomic<bool> stopped(false);
+    std::mutex resultMutex;
+    Result result;
+
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        workers.emplace_back([&] {
+            while (!stopped) {
+                const std::size_t game = nextGame++;
+                if (game >= options.games) {
+                    break;
+                }
+                const std::string& fen = openings.empty() ? std::string(START_FEN)
+                                                          : openings[(game / 2) % openings.size()];
+                const bool engineAIsWhite = game % 2 == 0;
+                const GameState::Result outcome = playGame(fen, engineAIsWhite);
+
+                std::lock_guard<std::mutex> lock(resultMutex);
+                if (outcome == GameState::Result::None) {
+                    std::cerr << "Skipping game " << game << ": invalid opening " << fen << '\n';
+                    continue;
+                }
+                if (outcome == GameState::Result::WhiteWin) {
+                    (engineAIsWhite ? result.stats.wins : result.stats.losses)++;
+                } else if (outcome == GameState::Result::BlackWin) {
+                    (engineAIsWhite ? result.stats.losses : result.stats.wins)++;
+                } else {
+                    result.stats.draws++;
+                }
+
+                const Verdict verdict = sprtVerdict(result.stats, result.llr);
+                if (result.verdict == Verdict::None && verdict != Verdict::None) {
+                    result.verdict = verdict;
+                    stopped = true;
+                }
+            }
+        });
+    }
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    return result;
+}
+
+GameState::Result MatchRunner::playGame(const std::string& fen, bool engineAIsWhite) const {
+    Board board;
+    Piece::Color sideToMove = Piece::Color::White;
+    if (!board.setupFromFEN(fen, sideToMove)) {
+        return GameState::Result::None;
+    }
+
+    AI engineA;
+    AI engineB;
+    configure(engineA, options.engineA);
+    configure(engineB, options.engineB);
+    const AI& white = engineAIsWhite ? engineA : engineB;
+    const AI& black = engineAIsWhite ? engineB : engineA;
+
+    GameState state;
+    state.reset(sideToMove);
+    for (int ply = 0; ply < options.maxPlies && !state.isGameOver(); ++ply) {
+        const Piece::Color color = state.getCurrentTurn();
+        const Move move = (color == Piece::Color::White ? white : black).getMove(&board, color);
+        const bool legal = move.getFrom().isValid() && state.makeMove(move, &board);
+        if (!legal) {
+            // No move or an illegal one: mated if in check, otherwise the mover forfeits.
+            const bool stalemate = !move.getFrom().isValid() && !board.isCheck(color);
+            if (stalemate) {
+                return GameState::Result::Draw;
+            }
+            return color == Piece::Color::White ? GameState::Result::BlackWin : GameState::Result::WhiteWin;
+        }
+    }
+
+    const GameState::Result result = state.getResult();
+    if (result == GameState::Result::WhiteWin || result == GameState::Result::BlackWin) {
+        return result;
+    }
+    return GameState::Result::Draw;
+}
+
+MatchRunner::Verdict MatchRunner::sprtVerdict(const MatchStats& stats, double& llr) const {
+    if (options.elo1 <= options.elo0) {
+        return Verdict::None;
+    }
+    llr = stats.logLikelihoodRatio(options.elo0, options.elo1);
+    if (llr >= std::log((1.0 - options.beta) / options.alpha)) {
+        return Verdict::AcceptH1;
+    }
+    if (llr <= std::log(options.beta / (1.0 - options.alpha))) {
+        return Verdict::AcceptH0;
+    }
+    return Verdict::None;
+}
+
+void MatchRunner::printReport(std::ostream& output, const Options& options, const Result& result) {
+    const MatchStats& stats = result.stats;
+    output << std::fixed << std::setprecision(1);
+    output << "Games: " << stats.games() << " (+" << stats.wins << " =" << stats.draws
+           << " -" << stats.losses << ")\n";
+    output << "Score: " << stats.score() * 100.0 << "%\n";
+    output << "Elo: " << stats.eloDifference() << " +/- " << stats.eloError() << '\n';
+
+    if (options.elo1 > options.elo0) {
+        output << std::setprecision(2);
+        output << "SPRT [" << options.elo0 << ", " << options.elo1 << "]: LLR " << result.llr
+               << " (" << std::log(options.beta / (1.0 - options.alpha)) << ", "
+               << std::log((1.0 - options.beta) / options.alpha) << ") ";
+        if (result.verdict == Verdict::AcceptH1) {
+            output << "H1 accepted\n";
+        } else if (result.verdict == Verdict::AcceptH0) {
+            output << "H0 accepted\n";
+        } else {
+            output << "inconclusive\n";
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "game/GameState.hpp"
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// Win/draw/loss counts from engine A's point of view.
+struct MatchStats {
+    std::size_t wins = 0;
+    std::size_t draws = 0;
+    std::size_t losses = 0;
+
+    std::size_t games() const { return wins + draws + losses; }
+    double score() const;
+    // Logistic Elo difference of A over B and the half-width of its 95% interval.
+    double eloDifference() const;
+    double eloError() const;
+    // Generalised SPRT log-likelihood ratio of H1 (elo1) against H0 (elo0).
+    double logLikelihoodRatio(double elo0, double elo1) const;
+};
+
+// Plays AI-vs-AI games headlessly, one game per worker thread at a time.
+// Each opening is played twice with colours swapped; games are adjudicated by
+// GameState, or drawn when they reach maxPlies.
+class MatchRunner {
+public:
+    struct Engine {
+        int depth = 3;
+        int moveTime = 0;
+    };
+
+    struct Options {
+        Engine engineA;
+        Engine engineB;
+        std::size_t games = 100;
+        int threads = 0;
+        int maxPlies = 300;
+        // SPRT stops the match early once either bound is crossed; off when elo1 <= elo0.
+        double elo0 = 0.0;
+        double elo1 = 0.0;
+        double alpha = 0.05;
+        double beta = 0.05;
+    };
+
+    enum class Verdict {
+        None,
+        AcceptH0,
+        AcceptH1
+    };
+
+    struct Result {
+        MatchStats stats;
+        Verdict verdict = Verdict::None;
+        double llr = 0.0;
+    };
+
+    explicit MatchRunner(const Options& options);
+
+    // Openings are full FENs; an empty list plays every game from the start position.
+    Result run(const std::vector<std::string>& openings) const;
+
+    static void printReport(std::ostream& output, const Options& options, const Result& result);
+
+private:
+    Options options;
+
+    // Result of one game, GameState::Result::None if it could not be started.
+    GameState::Result playGame(const std::string& fen, bool engineAIsWhite) const;
+    Verdict sprtVerdict(const MatchStats& stats, double& llr) const;
+};
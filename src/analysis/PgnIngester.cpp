@@ -0,0 +1,145 @@
+#include "PgnIngester.hpp"
+#include "utils/MappedFile.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <streambuf>
+#include <thread>
+#include <utility>
+
+namespace {
+// Lets PgnReader read a slice of the mapping without copying it.
+class MemoryBuffer : public std::streambuf {
+public:
+    MemoryBuffer(const char* begin, const char* end) {
+        char* start = const_cast<char*>(begin);
+        setg(start, start, const_cast<char*>(end));
+    }
+};
+}
+
+void IngestStats::add(const PgnGame& game) {
+    games++;
+    if (!game.error.empty()) {
+        rejected++;
+        return;
+    }
+
+    if (game.result == "1-0") whiteWins++;
+    else if (game.result == "0-1") blackWins++;
+    else if (game.result == "1/2-1/2") draws++;
+    else unfinished++;
+
+    plies += game.moves.size();
+
+    std::string opening = game.getTag("ECO");
+    if (opening.empty()) {
+        for (std::size_t i = 0; i < game.moves.size() && i < 2; ++i) {
+            opening += (i ? " " : "") + game.moves[i].toAlgebraic();
+        }
+    }
+    if (!opening.empty()) {
+        openings[opening]++;
+    }
+}
+
+void IngestStats::merge(const IngestStats& other) {
+    games += other.games;
+    whiteWins += other.whiteWins;
+    blackWins += other.blackWins;
+    draws += other.draws;
+    unfinished += other.unfinished;
+    rejected += other.rejected;
+    plies += other.plies;
+    for (const auto& opening : other.openings) {
+        openings[opening.first] += opening.second;
+    }
+}
+
+double IngestStats::averageLength() const {
+    const std::size_t accepted = games - rejected;
+    return accepted ? static_cast<double>(plies) / accepted : 0.0;
+}
+
+PgnIngester::PgnIngester(int threads) : threads(threads) {
+}
+
+bool PgnIngester::ingestFile(const std::string& path, IngestStats& stats) const {
+    MappedFile file(path);
+    if (!file.isValid()) {
+        std::cerr << "Could not open file: " << path << std::endl;
+        return false;
+    }
+    stats = ingest(file.data(), file.size());
+    return true;
+}
+
+IngestStats PgnIngester::ingest(const char* data, std::size_t size) const {
+    const unsigned int hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t threadCount = threads > 0 ? threads : hardwareThreads;
+    const std::vector<std::size_t> bounds = splitAtGames(data, size, threadCount);
+
+    std::vector<IngestStats> partial(bounds.size() - 1);
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i + 1 < bounds.size(); ++i) {
+        workers.emplace_back([&, i] {
+            MemoryBuffer buffer(data + bounds[i], data + bounds[i + 1]);
+            std::istream stream(&buffer);
+            PgnReader reader(stream);
+            PgnGame game;
+            while (reader.readGame(game)) {
+                partial[i].add(game);
+            }
+        });
+    }
+
+    IngestStats stats;
+    for (std::size_t i = 0; i < workers.size(); ++i) {
+        workers[i].join();
+        stats.merge(partial[i]);
+    }
+    return stats;
+}
+
+std::vector<std::size_t> PgnIngester::splitAtGames(const char* data, std::size_t size, std::size_t parts) {
+    static const char marker[] = "\n[Event ";
+    const std::size_t markerLength = sizeof(marker) - 1;
+
+    std::vector<std::size_t> bounds{0};
+    for (std::size_t part = 1; part < parts; ++part) {
+        const std::size_t target = std::max(bounds.back() + 1, size * part / parts);
+        if (target >= size) {
+            break;
+        }
+        const char* found = std::search(data + target, data + size, marker, marker + markerLength);
+        if (found == data + size) {
+            break;
+        }
+        bounds.push_back(found - data + 1);
+    }
+    bounds.push_back(size);
+    return bounds;
+}
+
+void PgnIngester::printReport(std::ostream& output, const IngestStats& stats, std::size_t topOpenings) {
+    output << "Games:          " << stats.games << "\n"
+           << "Rejected:       " << stats.rejected << "\n"
+           << "White wins:     " << stats.whiteWins << "\n"
+           << "Black wins:     " << stats.blackWins << "\n"
+           << "Draws:          " << stats.draws << "\n"
+           << "Unfinished:     " << stats.unfinished << "\n"
+           << "Average plies:  " << stats.averageLength() << "\n";
+
+    std::vector<std::pair<std::string, std::size_t>> openings(stats.openings.begin(), stats.openings.end());
+    std::sort(openings.begin(), openings.end(), [](const auto& a, const auto& b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+    if (openings.size() > topOpenings) {
+        openings.resize(topOpenings);
+    }
+
+    output << "Top openings:\n";
+    for (const auto& opening : openings) {
+        output << "  " << opening.first << ": " << opening.second << "\n";
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "utils/Pgn.hpp"
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+struct IngestStats {
+    std::size_t games = 0;
+    std::size_t whiteWins = 0;
+    std::size_t blackWins = 0;
+    std::size_t draws = 0;
+    std::size_t unfinished = 0;
+    std::size_t rejected = 0;
+    std::size_t plies = 0;
+    // Keyed by the ECO tag, or by the first two moves when the tag is missing.
+    std::map<std::string, std::size_t> openings;
+
+    void add(const PgnGame& game);
+    void merge(const IngestStats& other);
+    double averageLength() const;
+};
+
+// Replays a PGN archive on all cores: the file is memory-mapped, split at
+// "[Event " lines and each slice is read by its own PgnReader.
+class PgnIngester {
+public:
+    explicit PgnIngester(int threads = 0);
+
+    bool ingestFile(const std::string& path, IngestStats& stats) const;
+    IngestStats ingest(const char* data, std::size_t size) const;
+
+    // Offsets of `parts` slices (plus the end offset), each starting at a game.
+    static std::vector<std::size_t> splitAtGames(const char* data, std::size_t size, std::size_t parts);
+    static void printReport(std::ostream& output, const IngestStats& stats, std::size_t topOpenings = 10);
+
+private:
+    int threads;
+};
@@ -0,0 +1,74 @@
+#include "analysis/BatchAnalyzer.hpp"
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+void printUsage() {
+    std::cerr << "Usage: chess_analyze <positions.epd|-> [--depth N] [--movetime MS]\n"
+              << "                     [--threads N] [--format csv|jsonl] [--output FILE]\n";
+}
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printUsage();
+        return 1;
+    }
+
+    BatchAnalyzer::Options options;
+    std::string inputPath = argv[1];
+    std::string outputPath;
+
+    try {
+        for (int i = 2; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (i + 1 >= argc) {
+                printUsage();
+                return 1;
+            }
+            const std::string value = argv[++i];
+            if (arg == "--depth") {
+                options.depth = std::stoi(value);
+            } else if (arg == "--movetime") {
+                options.moveTime = std::stoi(value);
+            } else if (arg == "--threads") {
+                options.threads = std::stoi(value);
+            } else if (arg == "--format" && (value == "csv" || value == "jsonl")) {
+                options.format = value == "csv" ? BatchAnalyzer::Format::Csv : BatchAnalyzer::Format::Jsonl;
+            } else if (arg == "--output") {
+                outputPath = value;
+            } else {
+                printUsage();
+                return 1;
+            }
+        }
+    } catch (const std::exception&) {
+        printUsage();
+        return 1;
+    }
+
+    std::ifstream inputFile;
+    if (inputPath != "-") {
+        inputFile.open(inputPath);
+        if (!inputFile) {
+            std::cerr << "Error opening file for reading: " << inputPath << std::endl;
+            return 1;
+        }
+    }
+
+    std::ofstream outputFile;
+    if (!outputPath.empty()) {
+        outputFile.open(outputPath);
+        if (!outputFile) {
+            std::cerr << "Error opening file for writing: " << outputPath << std::endl;
+            return 1;
+        }
+    }
+
+    BatchAnalyzer analyzer(options);
+    const std::size_t count = analyzer.run(inputPath == "-" ? std::cin : inputFile,
+                                           outputPath.empty() ? std::cout : outputFile);
+    std::cerr << "Analysed " << count << " positions" << std::endl;
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include "analysis/PgnIngester.hpp"
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 3) {
+        std::cerr << "Usage: chess_ingest <games.pgn> [threads]\n";
+        return 1;
+    }
+
+    int threads = 0;
+    if (argc == 3) {
+        try {
+            threads = std::stoi(argv[2]);
+        } catch (const std::exception&) {
+            std::cerr << "Invalid thread count: " << argv[2] << "\n";
+            return 1;
+        }
+    }
+
+    PgnIngester ingester(threads);
+    IngestStats stats;
+    if (!ingester.ingestFile(argv[1], stats)) {
+        return 1;
+    }
+    PgnIngester::printReport(std::cout, stats);
+    return 0;
+}
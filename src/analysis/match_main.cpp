@@ -0,0 +1,86 @@
+#include "analysis/BatchAnalyzer.hpp"
+#include "analysis/MatchRunner.hpp"
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+void printUsage() {
+    std::cerr << "Usage: chess_match [--games N] [--threads N] [--openings FILE] [--max-plies N]\n"
+              << "                   [--depth-a N] [--depth-b N] [--movetime-a MS] [--movetime-b MS]\n"
+              << "                   [--elo0 E] [--elo1 E] [--alpha A] [--beta B]\n";
+}
+
+bool readOpenings(const std::string& path, std::vector<std::string>& openings) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Error opening file for reading: " << path << std::endl;
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        std::string fen;
+        std::string id;
+        if (line.empty() || line[0] == '#' || !BatchAnalyzer::parseLine(line, fen, id)) {
+            continue;
+        }
+        openings.push_back(fen);
+    }
+    return true;
+}
+}
+
+int main(int argc, char* argv[]) {
+    MatchRunner::Options options;
+    std::vector<std::string> openings;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (i + 1 >= argc) {
+                printUsage();
+                return 1;
+            }
+            const std::string value = argv[++i];
+            if (arg == "--games") {
+                options.games = std::stoul(value);
+            } else if (arg == "--threads") {
+                options.threads = std::stoi(value);
+            } else if (arg == "--openings") {
+                if (!readOpenings(value, openings)) {
+                    return 1;
+                }
+            } else if (arg == "--max-plies") {
+                options.maxPlies = std::stoi(value);
+            } else if (arg == "--depth-a") {
+                options.engineA.depth = std::stoi(value);
+            } else if (arg == "--depth-b") {
+                options.engineB.depth = std::stoi(value);
+            } else if (arg == "--movetime-a") {
+                options.engineA.moveTime = std::stoi(value);
+            } else if (arg == "--movetime-b") {
+                options.engineB.moveTime = std::stoi(value);
+            } else if (arg == "--elo0") {
+                options.elo0 = std::stod(value);
+            } else if (arg == "--elo1") {
+                options.elo1 = std::stod(value);
+            } else if (arg == "--alpha") {
+                options.alpha = std::stod(value);
+            } else if (arg == "--beta") {
+                options.beta = std::stod(value);
+            } else {
+                printUsage();
+                return 1;
+            }
+        }
+    } catch (const std::exception&) {
+        printUsage();
+        return 1;
+    }
+
+    MatchRunner runner(options);
+    const MatchRunner::Result result = runner.run(openings);
+    MatchRunner::printReport(std::cout, options, result);
+    return 0;
+}
@@ -1,4 +1,7 @@
 #include "Board.hpp"
+#include "Fen.hpp"
+#include "Zobrist.hpp"
+#include "moves/Move.hpp"
 #include "pieces/Piece.hpp"
 #include "pieces/Pawn.hpp"
 #include "pieces/Rook.hpp"
@@ -6,10 +9,11 @@
 #include "pieces/Bishop.hpp"
 #include "pieces/Queen.hpp"
 #include "pieces/King.hpp"
+#include "utils/Profiler.hpp"
 #include <stdexcept>
-#include <sstream>
 #include <cctype>
 #include <algorithm>
+#include <string_view>
 
 Board::Board() {
     setupEmptyBoard();
@@ -20,87 +24,51 @@ Board::Board(const std::string& fen) {
     setupFromFEN(fen);
 }
 
-Board::Board(const Board& other) : squares(BOARD_SIZE, std::vector<Square>(BOARD_SIZE)) {
-    for (int i = 0; i < BOARD_SIZE; ++i) {
-        for (int j = 0; j < BOARD_SIZE; ++j) {
-            squares[i][j] = other.squares[i][j];
-            if (other.squares[i][j].isOccupied()) {
-                Piece* originalPiece = other.squares[i][j].getPiece();
-                squares[i][j].setPiece(originalPiece->clone());
-            }
-        }
-    }
-    enPassantPosition = other.enPassantPosition;
-}
-
-Board& Board::operator=(const Board& other) {
-    if (this != &other) {
-        clear();
-        
-        squares.resize(BOARD_SIZE, std::vector<Square>(BOARD_SIZE));
-        for (int i = 0; i < BOARD_SIZE; ++i) {
-            for (int j = 0; j < BOARD_SIZE; ++j) {
-                squares[i][j] = other.squares[i][j];
-                if (other.squares[i][j].isOccupied()) {
-                    const Piece* originalPiece = other.squares[i][j].getPiece();
-                    squares[i][j].setPiece(originalPiece->clone());
-                }
-            }
-        }
-        enPassantPosition = other.enPassantPosition;
-    }
-    return *this;
-}
-
 void Board::setupEmptyBoard() {
-    squares.resize(BOARD_SIZE, std::vector<Square>(BOARD_SIZE));
-    for (int i = 0; i < BOARD_SIZE; ++i) {
-        for (int j = 0; j < BOARD_SIZE; ++j) {
-            const Square::Color squareColor = (i + j) % 2 == 0 ? Square::Color::White : Square::Color::Black;
-            squares[i][j] = Square(squareColor, Position(i, j));
-        }
+    for (int index = 0; index < SQUARE_COUNT; ++index) {
+        const Position pos = Position::fromIndex(index);
+        const Square::Color squareColor = (pos.getX() + pos.getY()) % 2 == 0 ? Square::Color::White : Square::Color::Black;
+        squares[index] = Square(squareColor, pos);
     }
     clearEnPassantPosition();
+    castlingRights = AllCastlingRights;
 }
 
 void Board::clear() {
-    for (int i = 0; i < BOARD_SIZE; ++i) {
-        for (int j = 0; j < BOARD_SIZE; ++j) {
-            if (squares[i][j].isOccupied()) {
-                delete squares[i][j].removePiece();
-            }
-        }
+    for (Square& square : squares) {
+        square.clear();
     }
     clearEnPassantPosition();
+    castlingRights = AllCastlingRights;
 }
 
 void Board::initialize() {
     clear();
     
-    placePiece(new Rook(Piece::Color::White), Position(0, 0));
-    placePiece(new Knight(Piece::Color::White), Position(1, 0));
-    placePiece(new Bishop(Piece::Color::White), Position(2, 0));
-    placePiece(new Queen(Piece::Color::White), Position(3, 0));
-    placePiece(new King(Piece::Color::White), Position(4, 0));
-    placePiece(new Bishop(Piece::Color::White), Position(5, 0));
-    placePiece(new Knight(Piece::Color::White), Position(6, 0));
-    placePiece(new Rook(Piece::Color::White), Position(7, 0));
+    placePiece(Rook(Piece::Color::White), Position(0, 0));
+    placePiece(Knight(Piece::Color::White), Position(1, 0));
+    placePiece(Bishop(Piece::Color::White), Position(2, 0));
+    placePiece(Queen(Piece::Color::White), Position(3, 0));
+    placePiece(King(Piece::Color::White), Position(4, 0));
+    placePiece(Bishop(Piece::Color::White), Position(5, 0));
+    placePiece(Knight(Piece::Color::White), Position(6, 0));
+    placePiece(Rook(Piece::Color::White), Position(7, 0));
     
     for (int i = 0; i < BOARD_SIZE; ++i) {
-        placePiece(new Pawn(Piece::Color::White), Position(i, 1));
+        placePiece(Pawn(Piece::Color::White), Position(i, 1));
     }
     
-    placePiece(new Rook(Piece::Color::Black), Position(0, 7));
-    placePiece(new Knight(Piece::Color::Black), Position(1, 7));
-    placePiece(new Bishop(Piece::Color::Black), Position(2, 7));
-    placePiece(new Queen(Piece::Color::Black), Position(3, 7));
-    placePiece(new King(Piece::Color::Black), Position(4, 7));
-    placePiece(new Bishop(Piece::Color::Black), Position(5, 7));
-    placePiece(new Knight(Piece::Color::Black), Position(6, 7));
-    placePiece(new Rook(Piece::Color::Black), Position(7, 7));
+    placePiece(Rook(Piece::Color::Black), Position(0, 7));
+    placePiece(Knight(Piece::Color::Black), Position(1, 7));
+    placePiece(Bishop(Piece::Color::Black), Position(2, 7));
+    placePiece(Queen(Piece::Color::Black), Position(3, 7));
+    placePiece(King(Piece::Color::Black), Position(4, 7));
+    placePiece(Bishop(Piece::Color::Black), Position(5, 7));
+    placePiece(Knight(Piece::Color::Black), Position(6, 7));
+    placePiece(Rook(Piece::Color::Black), Position(7, 7));
     
     for (int i = 0; i < BOARD_SIZE; ++i) {
-        placePiece(new Pawn(Piece::Color::Black), Position(i, 6));
+        placePiece(Pawn(Piece::Color::Black), Position(i, 6));
     }
 }
 
@@ -108,14 +76,14 @@ Square* Board::getSquare(const Position& pos) {
     if (!isPositionValid(pos)) {
         return nullptr;
     }
-    return &squares[pos.getX()][pos.getY()];
+    return &squares[pos.toIndex()];
 }
 
 const Square* Board::getSquare(const Position& pos) const {
     if (!isPositionValid(pos)) {
         return nullptr;
     }
-    return &squares[pos.getX()][pos.getY()];
+    return &squares[pos.toIndex()];
 }
 
 Square* Board::getSquare(int x, int y) {
@@ -126,27 +94,26 @@ const Square* Board::getSquare(int x, int y) const {
     return getSquare(Position(x, y));
 }
 
-bool Board::placePiece(Piece* piece, const Position& pos) {
-    if (!piece || !isPositionValid(pos)) return false;
+bool Board::placePiece(const Piece& piece, const Position& pos) {
+    if (piece.isNone() || !isPositionValid(pos)) return false;
     
     Square* square = getSquare(pos);
     if (!square || square->isOccupied()) return false;
     
-    const bool wasMoved = piece->hasMoved();
-    piece->setPosition(pos);
-    piece->setMoved(wasMoved); 
     square->setPiece(piece);
+    square->getPiece()->setMoved(piece.hasMoved());
     return true;
 }
 
-Piece* Board::removePiece(const Position& pos) {
+Piece Board::removePiece(const Position& pos) {
     if (!isPositionValid(pos)) {
-        return nullptr;
+        return Piece();
     }
     return getSquare(pos)->removePiece();
 }
 
 bool Board::movePiece(const Position& from, const Position& to) {
+    PROFILE_SCOPE("Board::movePiece");
     if (!isPositionValid(from) || !isPositionValid(to)) {
         return false;
     }
@@ -158,9 +125,9 @@ bool Board::movePiece(const Position& from, const Position& to) {
         return false;
     }
     
-    Piece* piece = fromSquare->getPiece();
+    Piece piece = *fromSquare->getPiece();
     
-    if (piece->getType() == Piece::Type::King && std::abs(to.getX() - from.getX()) == 2) {
+    if (piece.getType() == Piece::Type::King && std::abs(to.getX() - from.getX()) == 2) {
         int rookFromX = (to.getX() > from.getX()) ? 7 : 0;
         int rookToX = (to.getX() > from.getX()) ? 5 : 3;
         Position rookFrom(rookFromX, from.getY());
@@ -174,22 +141,24 @@ bool Board::movePiece(const Position& from, const Position& to) {
             return false;
         }
         
-        piece->setMoved(true);
+        piece.setMoved(true);
         fromSquare->removePiece();
         toSquare->setPiece(piece);
         
-        Piece* rook = rookFromSquare->removePiece();
-        rook->setMoved(true);
+        Piece rook = rookFromSquare->removePiece();
+        rook.setMoved(true);
         rookToSquare->setPiece(rook);
+        clearEnPassantPosition();
+        updateCastlingRights(from, to);
         
         return true;
     }
     
-    piece->setMoved(true);
+    piece.setMoved(true);
     
-    if (piece->getType() == Piece::Type::Pawn) {
+    if (piece.getType() == Piece::Type::Pawn) {
         if (std::abs(to.getY() - from.getY()) == 2) {
-            int direction = piece->getColor() == Piece::Color::White ? -1 : 1;
+            int direction = piece.getColor() == Piece::Color::White ? -1 : 1;
             setEnPassantPosition(Position(to.getX(), to.getY() + direction));
         } else {
             clearEnPassantPosition();
@@ -202,22 +171,55 @@ bool Board::movePiece(const Position& from, const Position& to) {
         clearEnPassantPosition();
     }
     
-    if (toSquare->isOccupied()) {
-        delete toSquare->removePiece();
-    }
-    
     fromSquare->removePiece();
     toSquare->setPiece(piece);
+    updateCastlingRights(from, to);
     
     return true;
 }
 
+void Board::updateCastlingRights(const Position& from, const Position& to) {
+    auto rightsAt = [](const Position& pos) -> std::uint8_t {
+        switch (pos.toIndex()) {
+            case 0:  return WhiteQueenside;
+            case 4:  return WhiteKingside | WhiteQueenside;
+            case 7:  return WhiteKingside;
+            case 56: return BlackQueenside;
+            case 60: return BlackKingside | BlackQueenside;
+            case 63: return BlackKingside;
+            default: return 0;
+        }
+    };
+    castlingRights &= ~(rightsAt(from) | rightsAt(to));
+}
+
+bool Board::applyMove(const Move& move) {
+    const bool isPromotion = move.getType() == Move::Type::Promotion;
+    if (isPromotion && (move.getPromotionPiece() == Piece::Type::Pawn ||
+                        move.getPromotionPiece() == Piece::Type::King)) {
+        return false;
+    }
+
+    if (!movePiece(move.getFrom(), move.getTo())) {
+        return false;
+    }
+
+    if (isPromotion) {
+        Square* square = getSquare(move.getTo());
+        Piece promoted(square->getPiece()->getColor(), move.getPromotionPiece(), move.getTo());
+        promoted.setMoved(true);
+        square->setPiece(promoted);
+    }
+    return true;
+}
+
 bool Board::isPositionValid(const Position& pos) const {
     return pos.getX() >= 0 && pos.getX() < BOARD_SIZE && 
            pos.getY() >= 0 && pos.getY() < BOARD_SIZE;
 }
 
 bool Board::isPositionAttacked(const Position& pos, Piece::Color attackerColor) const {
+    PROFILE_SCOPE("Board::isPositionAttacked");
     int pawnDirection = (attackerColor == Piece::Color::White) ? 1 : -1;
     Position leftPawn(pos.getX() - 1, pos.getY() - pawnDirection);
     Position rightPawn(pos.getX() + 1, pos.getY() - pawnDirection);
@@ -318,6 +320,7 @@ bool Board::isPositionDefended(const Position& pos, Piece::Color defenderColor)
 }
 
 bool Board::isCheck(const Piece::Color color) const {
+    PROFILE_SCOPE("Board::isCheck");
     Position kingPos(-1, -1);
     for (int x = 0; x < BOARD_SIZE; x++) {
         for (int y = 0; y < BOARD_SIZE; y++) {
@@ -382,7 +385,7 @@ bool Board::isCheck(const Piece::Color color) const {
             
             const Square* square = getSquare(current);
             if (square->isOccupied()) {
-                Piece* piece = square->getPiece();
+                const Piece* piece = square->getPiece();
                 if (piece->getColor() == enemyColor) {
                     bool canAttack = false;
                     if (std::abs(move.first) == std::abs(move.second)) {
@@ -403,6 +406,7 @@ bool Board::isCheck(const Piece::Color color) const {
 }
 
 bool Board::isCheckmate(Piece::Color color) const {
+    PROFILE_SCOPE("Board::isCheckmate");
     if (!isCheck(color)) {
         return false;
     }
@@ -433,12 +437,13 @@ bool Board::isCheckmate(Piece::Color color) const {
     }
 
     auto pieces = getPieces(color);
-    for (Piece* piece : pieces) {
+    Board tempBoard(*this);
+    for (const Piece* piece : pieces) {
         if (piece->getType() == Piece::Type::King) continue;  
 
         auto moves = piece->getPossibleMoves(this);
         for (const Position& move : moves) {
-            Board tempBoard(*this);
+            tempBoard = *this;
             if (tempBoard.movePiece(piece->getPosition(), move)) {
                 if (!tempBoard.isCheck(color)) {
                     return false;
@@ -450,13 +455,15 @@ bool Board::isCheckmate(Piece::Color color) const {
 }
 
 bool Board::isStalemate(const Piece::Color color) const {
+    PROFILE_SCOPE("Board::isStalemate");
     if (isCheck(color)) return false;
     
     auto pieces = getPieces(color);
+    Board tempBoard(*this);
     for (const Piece* piece : pieces) {
         auto moves = piece->getPossibleMoves(this);
         for (const Position& move : moves) {
-            Board tempBoard(*this);
+            tempBoard = *this;
             if (tempBoard.movePiece(piece->getPosition(), move) && !tempBoard.isCheck(color)) {
                 return false;
             }
@@ -465,8 +472,8 @@ bool Board::isStalemate(const Piece::Color color) const {
     return true;
 }
 
-std::vector<Piece*> Board::getPieces(const Piece::Color color) const {
-    std::vector<Piece*> pieces;
+std::vector<const Piece*> Board::getPieces(const Piece::Color color) const {
+    std::vector<const Piece*> pieces;
     for (int i = 0; i < BOARD_SIZE; ++i) {
         for (int j = 0; j < BOARD_SIZE; ++j) {
             const Square* square = getSquare(i, j);
@@ -478,12 +485,12 @@ std::vector<Piece*> Board::getPieces(const Piece::Color color) const {
     return pieces;
 }
 
-Piece* Board::getKing(const Piece::Color color) const {
+const Piece* Board::getKing(const Piece::Color color) const {
     for (int i = 0; i < BOARD_SIZE; ++i) {
         for (int j = 0; j < BOARD_SIZE; ++j) {
             const Square* square = getSquare(i, j);
             if (square->isOccupied()) {
-                Piece* piece = square->getPiece();
+                const Piece* piece = square->getPiece();
                 if (piece->getColor() == color && piece->getType() == Piece::Type::King) {
                     return piece;
                 }
@@ -516,7 +523,7 @@ bool Board::isSquareAttackedByPawn(const Position& pos, Piece::Color attackerCol
         
         const Square* square = getSquare(attackPos);
         if (square->isOccupied()) {
-            Piece* piece = square->getPiece();
+            const Piece* piece = square->getPiece();
             if (piece->getColor() == attackerColor && 
                 piece->getType() == Piece::Type::Pawn) {
                 return true;
@@ -540,7 +547,7 @@ bool Board::isSquareAttackedByKnight(const Position& pos, const Piece::Color att
         
         const Square* square = getSquare(attackPos);
         if (square->isOccupied()) {
-            Piece* piece = square->getPiece();
+            const Piece* piece = square->getPiece();
             if (piece->getColor() == attackerColor && 
                 piece->getType() == Piece::Type::Knight) {
                 return true;
@@ -563,7 +570,7 @@ bool Board::isSquareAttackedByBishop(const Position& pos, const Piece::Color att
             
             const Square* square = getSquare(current);
             if (square->isOccupied()) {
-                Piece* piece = square->getPiece();
+                const Piece* piece = square->getPiece();
                 if (piece->getColor() == attackerColor && 
                     piece->getType() == Piece::Type::Bishop) {
                     return true;
@@ -588,7 +595,7 @@ bool Board::isSquareAttackedByRook(const Position& pos, const Piece::Color attac
             
             const Square* square = getSquare(current);
             if (square->isOccupied()) {
-                Piece* piece = square->getPiece();
+                const Piece* piece = square->getPiece();
                 if (piece->getColor() == attackerColor && 
                     piece->getType() == Piece::Type::Rook) {
                     return true;
@@ -614,7 +621,7 @@ bool Board::isSquareAttackedByQueen(const Position& pos, const Piece::Color atta
             
             const Square* square = getSquare(current);
             if (square->isOccupied()) {
-                Piece* piece = square->getPiece();
+                const Piece* piece = square->getPiece();
                 if (piece->getColor() == attackerColor && 
                     piece->getType() == Piece::Type::Queen) {
                     return true;
@@ -639,7 +646,7 @@ bool Board::isSquareAttackedByKing(const Position& pos, const Piece::Color attac
         
         const Square* square = getSquare(attackPos);
         if (square->isOccupied()) {
-            Piece* piece = square->getPiece();
+            const Piece* piece = square->getPiece();
             if (piece->getColor() == attackerColor && 
                 piece->getType() == Piece::Type::King) {
                 return true;
@@ -652,9 +659,8 @@ bool Board::isSquareAttackedByKing(const Position& pos, const Piece::Color attac
 void Board::setupFromFEN(const std::string& fen) {
     clear();
     
-    std::istringstream iss(fen);
-    std::string placement;
-    iss >> placement;
+    const std::size_t start = std::min(fen.find_first_not_of(' '), fen.size());
+    const std::string_view placement = std::string_view(fen).substr(start, fen.find(' ', start) - start);
     
     int rank = 7;
     int file = 0;
@@ -671,20 +677,20 @@ void Board::setupFromFEN(const std::string& fen) {
             continue;
         }
         
-        Piece* piece = nullptr;
+        Piece piece;
         const Piece::Color color = std::isupper(c) ? Piece::Color::White : Piece::Color::Black;
         char pieceChar = std::tolower(c);
         
         switch (pieceChar) {
-            case 'p': piece = new Pawn(color); break;
-            case 'r': piece = new Rook(color); break;
-            case 'n': piece = new Knight(color); break;
-            case 'b': piece = new Bishop(color); break;
-            case 'q': piece = new Queen(color); break;
-            case 'k': piece = new King(color); break;
+            case 'p': piece = Pawn(color); break;
+            case 'r': piece = Rook(color); break;
+            case 'n': piece = Knight(color); break;
+            case 'b': piece = Bishop(color); break;
+            case 'q': piece = Queen(color); break;
+            case 'k': piece = King(color); break;
         }
         
-        if (piece) {
+        if (!piece.isNone()) {
             placePiece(piece, Position(file, rank));
         }
         
@@ -692,36 +698,18 @@ void Board::setupFromFEN(const std::string& fen) {
     }
 }
 
-std::string Board::toFEN() const {
-    std::string fen;
-    
-    for (int rank = 7; rank >= 0; rank--) {
-        int emptyCount = 0;
-        
-        for (int file = 0; file < BOARD_SIZE; file++) {
-            const Square* square = getSquare(file, rank);
-            
-            if (square->isOccupied()) {
-                if (emptyCount > 0) {
-                    fen += std::to_string(emptyCount);
-                    emptyCount = 0;
-                }
-                fen += square->getPiece()->getSymbol();
-            } else {
-                emptyCount++;
-            }
-        }
-        
-        if (emptyCount > 0) {
-            fen += std::to_string(emptyCount);
-        }
-        
-        if (rank > 0) {
-            fen += '/';
-        }
+bool Board::setupFromFEN(const std::string& fen, Piece::Color& sideToMove) {
+    Fen::State state;
+    if (Fen::parse(fen, *this, state) != Fen::Error::None) {
+        return false;
     }
-    
-    return fen;
+    sideToMove = state.sideToMove;
+    return true;
+}
+
+std::string Board::toFEN() const {
+    char buffer[Fen::MAX_LENGTH];
+    return std::string(buffer, Fen::writePlacement(*this, buffer, sizeof(buffer)));
 }
 
 std::string Board::toString() const {
@@ -741,4 +729,30 @@ std::string Board::toString() const {
     }
     result += "  a b c d e f g h\n";
     return result;
-}
\ No newline at end of file
+}
+
+std::uint64_t Board::getHash() const {
+    std::uint64_t hash = 0;
+    for (int index = 0; index < SQUARE_COUNT; ++index) {
+        const Square& square = squares[index];
+        if (square.isOccupied()) {
+            hash ^= Zobrist::pieceKey(square.getPiece()->getCode(), index);
+        }
+    }
+
+    if (enPassantPosition.isValid()) {
+        const bool whiteCaptures = enPassantPosition.getY() == 5;
+        const Piece::Code capturer = Piece::makeCode(
+            whiteCaptures ? Piece::Color::White : Piece::Color::Black, Piece::Type::Pawn);
+        const int captureRank = whiteCaptures ? 4 : 3;
+        for (int dx : {-1, 1}) {
+            const Square* square = getSquare(enPassantPosition.getX() + dx, captureRank);
+            if (square && square->isOccupied() && square->getPiece()->getCode() == capturer) {
+                hash ^= Zobrist::enPassantKey(enPassantPosition.getX());
+                break;
+            }
+        }
+    }
+
+    return hash ^ Zobrist::castlingKey(castlingRights);
+}
@@ -1,34 +1,53 @@
 #pragma once
 #include "Square.hpp"
+#include <array>
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <memory>
 
+class Move;
+
 class Board {
 public:
     static const int BOARD_SIZE = 8;
+    static const int SQUARE_COUNT = BOARD_SIZE * BOARD_SIZE;
+
+    enum CastlingRight : std::uint8_t {
+        WhiteKingside = 1,
+        WhiteQueenside = 2,
+        BlackKingside = 4,
+        BlackQueenside = 8,
+        AllCastlingRights = 15
+    };
     
     Board();
     explicit Board(const std::string& fen);
-    Board(const Board& other);
-    Board& operator=(const Board& other);
+    Board(const Board& other) = default;
+    Board& operator=(const Board& other) = default;
     
     Square* getSquare(const Position& pos);
     const Square* getSquare(const Position& pos) const;
     Square* getSquare(int x, int y);
     const Square* getSquare(int x, int y) const;
+    // index is rank-major: a1 = 0, h1 = 7, a8 = 56 (see Position::toIndex).
+    Square& getSquareAt(int index) { return squares[index]; }
+    const Square& getSquareAt(int index) const { return squares[index]; }
     
-    bool placePiece(Piece* piece, const Position& pos);
-    Piece* removePiece(const Position& pos);
+    // The board stores a copy of `piece` on the square.
+    bool placePiece(const Piece& piece, const Position& pos);
+    Piece removePiece(const Position& pos);
     bool movePiece(const Position& from, const Position& to);
+    // movePiece plus promotion; does not check legality.
+    bool applyMove(const Move& move);
     
     bool isPositionValid(const Position& pos) const;
     bool isPositionAttacked(const Position& pos, Piece::Color attackerColor) const;
     bool isPositionDefended(const Position& pos, Piece::Color defenderColor) const;
     
-    std::vector<Piece*> getPieces(Piece::Color color) const;
+    std::vector<const Piece*> getPieces(Piece::Color color) const;
     std::vector<Position> getAttackedPositions(Piece::Color attackerColor) const;
-    Piece* getKing(Piece::Color color) const;
+    const Piece* getKing(Piece::Color color) const;
     
     bool isCheck(Piece::Color color) const;
     bool isCheckmate(Piece::Color color) const;
@@ -38,17 +57,28 @@ public:
     void initialize();
     std::string toFEN() const;
     std::string toString() const;
+    // Zobrist key of placement, castling rights and en passant; side to move is added by GameState.
+    std::uint64_t getHash() const;
 
     Position getEnPassantPosition() const { return enPassantPosition; }
     void setEnPassantPosition(const Position& pos) { enPassantPosition = pos; }
     void clearEnPassantPosition() { enPassantPosition = Position(-1, -1); }
+    // Cleared as kings and rooks leave, or rooks are captured on, their home squares.
+    // Empty and cleared boards start with every right; FEN sets them exactly.
+    std::uint8_t getCastlingRights() const { return castlingRights; }
+    void setCastlingRights(std::uint8_t rights) { castlingRights = rights & AllCastlingRights; }
+    bool hasCastlingRight(CastlingRight right) const { return (castlingRights & right) != 0; }
     void setupFromFEN(const std::string& fen);
+    // Strict full FEN via Fen::parse; leaves the board untouched on invalid input.
+    bool setupFromFEN(const std::string& fen, Piece::Color& sideToMove);
     
 private:
-    std::vector<std::vector<Square>> squares;
+    std::array<Square, SQUARE_COUNT> squares;
     Position enPassantPosition;
+    std::uint8_t castlingRights;
 
     void setupEmptyBoard();
+    void updateCastlingRights(const Position& from, const Position& to);
 
     bool isSquareAttackedByPawn(const Position& pos, Piece::Color attackerColor) const;
     bool isSquareAttackedByKnight(const Position& pos, Piece::Color attackerColor) const;
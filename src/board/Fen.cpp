@@ -0,0 +1,301 @@
+#include "Fen.hpp"
+
+namespace {
+class Cursor {
+public:
+    explicit Cursor(std::string_view text) : text(text), index(0) {}
+
+    bool atEnd() const { return index >= text.size(); }
+    char peek() const { return atEnd() ? '\0' : text[index]; }
+    char next() { return atEnd() ? '\0' : text[index++]; }
+
+    // Returns false if no separator was found before a further field.
+    bool skipSpaces() {
+        const std::size_t start = index;
+        while (!atEnd() && (text[index] == ' ' || text[index] == '\t')) {
+            index++;
+        }
+        return index > start;
+    }
+
+    std::string_view field() {
+        const std::size_t start = index;
+        while (!atEnd() && text[index] != ' ' && text[index] != '\t') {
+            index++;
+        }
+        return text.substr(start, index - start);
+    }
+
+private:
+    std::string_view text;
+    std::size_t index;
+};
+
+bool pieceFromChar(char c, Piece& piece) {
+    const Piece::Color color = (c >= 'A' && c <= 'Z') ? Piece::Color::White : Piece::Color::Black;
+    switch (c | 0x20) {
+        case 'p': piece = Piece(color, Piece::Type::Pawn); return true;
+        case 'n': piece = Piece(color, Piece::Type::Knight); return true;
+        case 'b': piece = Piece(color, Piece::Type::Bishop); return true;
+        case 'r': piece = Piece(color, Piece::Type::Rook); return true;
+        case 'q': piece = Piece(color, Piece::Type::Queen); return true;
+        case 'k': piece = Piece(color, Piece::Type::King); return true;
+        default: return false;
+    }
+}
+
+bool parseNumber(std::string_view field, int& value) {
+    if (field.empty() || field.size() > 6) {
+        return false;
+    }
+    value = 0;
+    for (char c : field) {
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        value = value * 10 + (c - '0');
+    }
+    return true;
+}
+
+bool hasPiece(const Board& board, int x, int y, Piece::Code code) {
+    const Piece* piece = board.getSquare(x, y)->getPiece();
+    return piece && piece->getCode() == code;
+}
+
+class Writer {
+public:
+    Writer(char* buffer, std::size_t size) : buffer(buffer), size(size), length(0) {}
+
+    void put(char c) {
+        if (length + 1 < size) {
+            buffer[length] = c;
+        }
+        length++;
+    }
+
+    void putNumber(int value) {
+        char digits[12];
+        int count = 0;
+        do {
+            digits[count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+        while (count > 0) {
+            put(digits[--count]);
+        }
+    }
+
+    std::size_t finish() {
+        if (length + 1 > size) {
+            if (size > 0) buffer[0] = '\0';
+            return 0;
+        }
+        buffer[length] = '\0';
+        return length;
+    }
+
+private:
+    char* buffer;
+    std::size_t size;
+    std::size_t length;
+};
+
+void writePlacementTo(const Board& board, Writer& writer) {
+    for (int rank = 7; rank >= 0; rank--) {
+        int emptyCount = 0;
+        for (int file = 0; file < Board::BOARD_SIZE; file++) {
+            const Piece* piece = board.getSquare(file, rank)->getPiece();
+            if (piece) {
+                if (emptyCount > 0) {
+                    writer.put(static_cast<char>('0' + emptyCount));
+                    emptyCount = 0;
+                }
+                writer.put(piece->getSymbol());
+            } else {
+                emptyCount++;
+            }
+        }
+        if (emptyCount > 0) {
+            writer.put(static_cast<char>('0' + emptyCount));
+        }
+        if (rank > 0) {
+            writer.put('/');
+        }
+    }
+}
+}
+
+Fen::Error Fen::parsePlacement(std::string_view placement, Board& board) {
+    Board position;
+    int rank = 7;
+    int file = 0;
+    int whiteKings = 0;
+    int blackKings = 0;
+
+    for (char c : placement) {
+        if (c == '/') {
+            if (file != 8) return Error::RankLength;
+            if (--rank < 0) return Error::RankCount;
+            file = 0;
+        } else if (c >= '1' && c <= '8') {
+            file += c - '0';
+            if (file > 8) return Error::RankLength;
+        } else {
+            Piece piece;
+            if (!pieceFromChar(c, piece)) return Error::Placement;
+            if (file >= 8) return Error::RankLength;
+            if (piece.getType() == Piece::Type::Pawn && (rank == 0 || rank == 7)) {
+                return Error::PawnOnBackRank;
+            }
+            if (piece.getType() == Piece::Type::King) {
+                (piece.getColor() == Piece::Color::White ? whiteKings : blackKings)++;
+            }
+            position.placePiece(piece, Position(file, rank));
+            file++;
+        }
+    }
+
+    if (rank != 0) return Error::RankCount;
+    if (file != 8) return Error::RankLength;
+    if (whiteKings != 1 || blackKings != 1) return Error::KingCount;
+
+    board = position;
+    return Error::None;
+}
+
+Fen::Error Fen::parse(std::string_view fen, Board& board, State& state) {
+    Cursor cursor(fen);
+    cursor.skipSpaces();
+
+    Board position;
+    const Error placementError = parsePlacement(cursor.field(), position);
+    if (placementError != Error::None) {
+        return placementError;
+    }
+
+    State parsed;
+    if (!cursor.skipSpaces()) return Error::SideToMove;
+    const std::string_view side = cursor.field();
+    if (side == "w") parsed.sideToMove = Piece::Color::White;
+    else if (side == "b") parsed.sideToMove = Piece::Color::Black;
+    else return Error::SideToMove;
+
+    if (!cursor.skipSpaces()) return Error::Castling;
+    const std::string_view castling = cursor.field();
+    std::uint8_t castlingRights = 0;
+    if (castling != "-") {
+        static const char order[] = "KQkq";
+        std::size_t next = 0;
+        for (char c : castling) {
+            while (next < 4 && order[next] != c) next++;
+            if (next == 4) return Error::Castling;
+            castlingRights |= 1 << next++;
+        }
+        if (castling.empty()) return Error::Castling;
+    }
+
+    const bool whiteKingHome = hasPiece(position, 4, 0, Piece::Code::WhiteKing);
+    const bool blackKingHome = hasPiece(position, 4, 7, Piece::Code::BlackKing);
+    const struct { Board::CastlingRight right; bool kingHome; int x; int y; Piece::Code rook; } rooks[] = {
+        {Board::WhiteKingside, whiteKingHome, 7, 0, Piece::Code::WhiteRook},
+        {Board::WhiteQueenside, whiteKingHome, 0, 0, Piece::Code::WhiteRook},
+        {Board::BlackKingside, blackKingHome, 7, 7, Piece::Code::BlackRook},
+        {Board::BlackQueenside, blackKingHome, 0, 7, Piece::Code::BlackRook}
+    };
+    for (const auto& entry : rooks) {
+        if ((castlingRights & entry.right) &&
+            (!entry.kingHome || !hasPiece(position, entry.x, entry.y, entry.rook))) {
+            return Error::Castling;
+        }
+    }
+    position.setCastlingRights(castlingRights);
+
+    if (!cursor.skipSpaces()) return Error::EnPassant;
+    const std::string_view enPassant = cursor.field();
+    if (enPassant != "-") {
+        const int targetRank = parsed.sideToMove == Piece::Color::White ? 5 : 2;
+        if (enPassant.size() != 2 || enPassant[0] < 'a' || enPassant[0] > 'h' ||
+            enPassant[1] - '1' != targetRank) {
+            return Error::EnPassant;
+        }
+        const int x = enPassant[0] - 'a';
+        const int pawnRank = parsed.sideToMove == Piece::Color::White ? 4 : 3;
+        const Piece::Code pawn = parsed.sideToMove == Piece::Color::White ? Piece::Code::BlackPawn
+                                                                         : Piece::Code::WhitePawn;
+        if (!hasPiece(position, x, pawnRank, pawn)) return Error::EnPassant;
+        parsed.enPassant = Position(x, targetRank);
+        position.setEnPassantPosition(parsed.enPassant);
+    }
+
+    if (cursor.skipSpaces() && !cursor.atEnd()) {
+        if (!parseNumber(cursor.field(), parsed.halfMoveClock)) return Error::HalfMoveClock;
+        if (!cursor.skipSpaces() || cursor.atEnd()) return Error::FullMoveNumber;
+        if (!parseNumber(cursor.field(), parsed.fullMoveNumber) || parsed.fullMoveNumber < 1) {
+            return Error::FullMoveNumber;
+        }
+        cursor.skipSpaces();
+    }
+    if (!cursor.atEnd()) return Error::TrailingCharacters;
+
+    board = position;
+    state = parsed;
+    return Error::None;
+}
+
+std::size_t Fen::writePlacement(const Board& board, char* buffer, std::size_t size) {
+    Writer writer(buffer, size);
+    writePlacementTo(board, writer);
+    return writer.finish();
+}
+
+std::size_t Fen::write(const Board& board, const State& state, char* buffer, std::size_t size) {
+    Writer writer(buffer, size);
+    writePlacementTo(board, writer);
+
+    writer.put(' ');
+    writer.put(state.sideToMove == Piece::Color::White ? 'w' : 'b');
+
+    writer.put(' ');
+    const std::uint8_t castlingRights = board.getCastlingRights();
+    if (castlingRights == 0) {
+        writer.put('-');
+    } else {
+        static const char letters[] = "KQkq";
+        for (int i = 0; i < 4; ++i) {
+            if (castlingRights & (1 << i)) writer.put(letters[i]);
+        }
+    }
+
+    writer.put(' ');
+    if (state.enPassant.isValid()) {
+        writer.put(static_cast<char>('a' + state.enPassant.getX()));
+        writer.put(static_cast<char>('1' + state.enPassant.getY()));
+    } else {
+        writer.put('-');
+    }
+
+    writer.put(' ');
+    writer.putNumber(state.halfMoveClock);
+    writer.put(' ');
+    writer.putNumber(state.fullMoveNumber);
+    return writer.finish();
+}
+
+const char* Fen::errorMessage(Error error) {
+    switch (error) {
+        case Error::None:               return "no error";
+        case Error::Placement:          return "invalid character in piece placement";
+        case Error::RankCount:          return "piece placement must have 8 ranks";
+        case Error::RankLength:         return "rank does not describe 8 squares";
+        case Error::KingCount:          return "each side must have exactly one king";
+        case Error::PawnOnBackRank:     return "pawn on the first or eighth rank";
+        case Error::SideToMove:         return "side to move must be 'w' or 'b'";
+        case Error::Castling:           return "invalid castling availability";
+        case Error::EnPassant:          return "invalid en passant square";
+        case Error::HalfMoveClock:      return "invalid halfmove clock";
+        case Error::FullMoveNumber:     return "invalid fullmove number";
+        case Error::TrailingCharacters: return "unexpected characters after FEN";
+    }
+    return "unknown error";
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include "Board.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Hand-written FEN reader and writer: no streams, no heap allocation.
+class Fen {
+public:
+    enum class Error {
+        None,
+        Placement,
+        RankCount,
+        RankLength,
+        KingCount,
+        PawnOnBackRank,
+        SideToMove,
+        Castling,
+        EnPassant,
+        HalfMoveClock,
+        FullMoveNumber,
+        TrailingCharacters
+    };
+
+    struct State {
+        Piece::Color sideToMove = Piece::Color::White;
+        Position enPassant = Position(-1, -1);
+        int halfMoveClock = 0;
+        int fullMoveNumber = 1;
+    };
+
+    // Longest possible FEN plus the terminating NUL.
+    static const std::size_t MAX_LENGTH = 96;
+
+    // The clocks may be omitted (EPD style); everything present is validated.
+    // Castling availability goes to Board::setCastlingRights.
+    // The board is only written when the whole string is valid.
+    static Error parse(std::string_view fen, Board& board, State& state);
+    // Placement field only, as Board::setupFromFEN always accepted.
+    static Error parsePlacement(std::string_view placement, Board& board);
+
+    // Writes a NUL-terminated FEN; returns its length, or 0 if `size` is too small.
+    static std::size_t write(const Board& board, const State& state, char* buffer, std::size_t size);
+    static std::size_t writePlacement(const Board& board, char* buffer, std::size_t size);
+
+    static const char* errorMessage(Error error);
+};
@@ -3,45 +3,42 @@
 Square::Square() : 
     color(Color::White),
     position(0, 0),
-    piece(nullptr) {
+    piece() {
 }
 
 Square::Square(const Color color) :
     color(color),
     position(0, 0),
-    piece(nullptr) {
+    piece() {
 }
 
 Square::Square(const Color color, const Position position) :
     color(color),
     position(position),
-    piece(nullptr) {
+    piece() {
 }
 
-void Square::setPiece(Piece* newPiece) {
-    if (piece != nullptr) {
-        clear();
-    }
+void Square::setPiece(const Piece& newPiece) {
     piece = newPiece;
-    if (piece != nullptr) {
-        piece->setPosition(position);
+    if (!piece.isNone()) {
+        piece.setPosition(position);
     }
 }
 
-Piece* Square::removePiece() {
-    Piece* removedPiece = piece;
-    piece = nullptr;
+Piece Square::removePiece() {
+    Piece removedPiece = piece;
+    piece = Piece();
     return removedPiece;
 }
 
 void Square::clear() {
-    piece = nullptr;
+    piece = Piece();
 }
 
 bool Square::operator==(const Square& other) const {
     return position == other.position && 
            color == other.color && 
-           piece == other.piece;
+           piece.getCode() == other.piece.getCode();
 }
 
 bool Square::operator!=(const Square& other) const {
@@ -53,7 +50,7 @@ std::string Square::toString() const {
     result += position.toAlgebraic();
     result += "(";
     result += (color == Color::White ? "White" : "Black");
-    result += piece != nullptr ? ", Occupied" : ", Empty";
+    result += isOccupied() ? ", Occupied" : ", Empty";
     result += ")";
     return result;
 }
@@ -15,12 +15,13 @@ public:
     Square(Color color, Position position);
 
     Color getColor() const { return color; }
-    bool isOccupied() const { return piece != nullptr; }
+    bool isOccupied() const { return !piece.isNone(); }
     Position getPosition() const { return position; }
-    Piece* getPiece() const { return piece; }
+    Piece* getPiece() { return piece.isNone() ? nullptr : &piece; }
+    const Piece* getPiece() const { return piece.isNone() ? nullptr : &piece; }
 
-    void setPiece(Piece* newPiece);
-    Piece* removePiece();
+    void setPiece(const Piece& newPiece);
+    Piece removePiece();
     void clear();
 
     bool operator==(const Square& other) const;
@@ -31,5 +32,6 @@ public:
 private:
     Color color;
     Position position;
-    Piece* piece;
+    // Stored inline; getPiece() returns nullptr for an empty square.
+    Piece piece;
 };
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include "StaticExchange.hpp"
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+using Bitboard = std::uint64_t;
+
+const int PIECE_VALUES[] = {100, 320, 330, 500, 900, 20000};
+
+Bitboard bit(int square) { return Bitboard(1) << square; }
+
+struct Occupancy {
+    // Indexed by colour, then by Piece::Type.
+    Bitboard pieces[2][6] = {};
+    Bitboard all = 0;
+
+    explicit Occupancy(const Board& board) {
+        for (int index = 0; index < Board::SQUARE_COUNT; ++index) {
+            const Square& square = board.getSquareAt(index);
+            if (square.isOccupied()) {
+                const Piece* piece = square.getPiece();
+                pieces[piece->getColor() == Piece::Color::White ? 0 : 1][static_cast<int>(piece->getType())] |= bit(index);
+                all |= bit(index);
+            }
+        }
+    }
+
+    Bitboard byType(Piece::Type type) const {
+        return pieces[0][static_cast<int>(type)] | pieces[1][static_cast<int>(type)];
+    }
+
+    Bitboard byColor(int color) const {
+        Bitboard result = 0;
+        for (Bitboard set : pieces[color]) {
+            result |= set;
+        }
+        return result;
+    }
+};
+
+Bitboard stepAttacks(int square, const int (*steps)[2], int count) {
+    Bitboard attacks = 0;
+    for (int i = 0; i < count; ++i) {
+        const int file = square % 8 + steps[i][0];
+        const int rank = square / 8 + steps[i][1];
+        if (file >= 0 && file < 8 && rank >= 0 && rank < 8) {
+            attacks |= bit(rank * 8 + file);
+        }
+    }
+    return attacks;
+}
+
+Bitboard rayAttacks(int square, Bitboard occupied, const int (*directions)[2]) {
+    Bitboard attacks = 0;
+    for (int d = 0; d < 4; ++d) {
+        int file = square % 8 + directions[d][0];
+        int rank = square / 8 + directions[d][1];
+        while (file >= 0 && file < 8 && rank >= 0 && rank < 8) {
+            attacks |= bit(rank * 8 + file);
+            if (occupied & bit(rank * 8 + file)) {
+                break;
+            }
+            file += directions[d][0];
+            rank += directions[d][1];
+        }
+    }
+    return attacks;
+}
+
+// Every piece of either colour attacking `square` through `occupied`.
+Bitboard attackersTo(const Occupancy& board, int square, Bitboard occupied) {
+    static const int knightSteps[8][2] = {{1, 2}, {2, 1}, {2, -1}, {1, -2}, {-1, -2}, {-2, -1}, {-2, 1}, {-1, 2}};
+    static const int kingSteps[8][2] = {{-1, -1}, {0, -1}, {1, -1}, {-1, 0}, {1, 0}, {-1, 1}, {0, 1}, {1, 1}};
+    // A white pawn attacks the square from below, a black pawn from above.
+    static const int whitePawnSources[2][2] = {{-1, -1}, {1, -1}};
+    static const int blackPawnSources[2][2] = {{-1, 1}, {1, 1}};
+    static const int straight[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+    static const int diagonal[4][2] = {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+
+    const Bitboard queens = board.byType(Piece::Type::Queen);
+    return (stepAttacks(square, whitePawnSources, 2) & board.pieces[0][static_cast<int>(Piece::Type::Pawn)]) |
+           (stepAttacks(square, blackPawnSources, 2) & board.pieces[1][static_cast<int>(Piece::Type::Pawn)]) |
+           (stepAttacks(square, knightSteps, 8) & board.byType(Piece::Type::Knight)) |
+           (stepAttacks(square, kingSteps, 8) & board.byType(Piece::Type::King)) |
+           (rayAttacks(square, occupied, straight) & (board.byType(Piece::Type::Rook) | queens)) |
+           (rayAttacks(square, occupied, diagonal) & (board.byType(Piece::Type::Bishop) | queens));
+}
+
+int lowestSquare(Bitboard bits) {
+    int square = 0;
+    while (!((bits >> square) & 1)) {
+        square++;
+    }
+    return square;
+}
+}
+
+int StaticExchange::pieceValue(Piece::Type type) {
+    return PIECE_VALUES[static_cast<int>(type)];
+}
+
+int StaticExchange::evaluate(const Board& board, const Move& move) {
+    const Square* fromSquare = board.getSquare(move.getFrom());
+    const Square* toSquare = board.getSquare(move.getTo());
+    if (!fromSquare || !toSquare || !fromSquare->isOccupied()) {
+        return 0;
+    }
+
+    const Occupancy position(board);
+    const int from = move.getFrom().toIndex();
+    const int target = move.getTo().toIndex();
+    const Piece* mover = fromSquare->getPiece();
+    Bitboard occupied = position.all & ~bit(from);
+
+    int gain[32];
+    int depth = 0;
+    gain[0] = toSquare->isOccupied() ? pieceValue(toSquare->getPiece()->getType()) : 0;
+    int onTarget = pieceValue(mover->getType());
+
+    if (move.getType() == Move::Type::EnPassant) {
+        gain[0] = pieceValue(Piece::Type::Pawn);
+        occupied &= ~bit(target + (mover->getColor() == Piece::Color::White ? -8 : 8));
+    } else if (move.getType() == Move::Type::Promotion) {
+        const int promoted = pieceValue(move.getPromotionPiece());
+        gain[0] += promoted - pieceValue(Piece::Type::Pawn);
+        onTarget = promoted;
+    }
+
+    int side = mover->getColor() == Piece::Color::White ? 1 : 0;
+    Bitboard attackers = attackersTo(position, target, occupied) & occupied;
+    while (depth < 31) {
+        const Bitboard ours = attackers & position.byColor(side);
+        if (!ours) {
+            break;
+        }
+
+        // Least valuable attacker first.
+        int type = 0;
+        while (!(ours & position.pieces[side][type])) {
+            type++;
+        }
+        const int attacker = lowestSquare(ours & position.pieces[side][type]);
+
+        // A king may only take last.
+        if (type == static_cast<int>(Piece::Type::King) &&
+            (attackers & ~bit(attacker) & position.byColor(1 - side))) {
+            break;
+        }
+
+        depth++;
+        gain[depth] = onTarget - gain[depth - 1];
+
+        onTarget = PIECE_VALUES[type];
+        occupied &= ~bit(attacker);
+        attackers = attackersTo(position, target, occupied) & occupied;
+        side = 1 - side;
+    }
+
+    // Each side may stop recapturing when that is better for it.
+    while (depth > 0) {
+        gain[depth - 1] = -std::max(-gain[depth - 1], gain[depth]);
+        depth--;
+    }
+    return gain[0];
+}
+
+bool StaticExchange::isAtLeast(const Board& board, const Move& move, int threshold) {
+    return evaluate(board, move) >= threshold;
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include "board/Board.hpp"
+#include "moves/Move.hpp"
+
+// Static exchange evaluation: the material balance, for the side making
+// `move`, once both sides have recaptured on the target square with their
+// least valuable attacker for as long as it pays. Sliders behind a capturing
+// piece join in as it leaves (x-rays). Pins and checks are ignored.
+class StaticExchange {
+public:
+    static int evaluate(const Board& board, const Move& move);
+    // True when the move wins or keeps at least `threshold` centipawns.
+    static bool isAtLeast(const Board& board, const Move& move, int threshold);
+    static int pieceValue(Piece::Type type);
+};
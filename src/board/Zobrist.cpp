@@ -0,0 +1,53 @@
+#include "Zobrist.hpp"
+
+namespace {
+    // splitmix64 with a fixed seed, so keys are identical across runs and builds.
+    std::uint64_t nextKey(std::uint64_t& state) {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+}
+
+Zobrist::Keys::Keys() {
+    std::uint64_t state = 0x43484553534B4559ULL;
+    for (int code = 0; code < CODE_COUNT; ++code) {
+        for (int square = 0; square < SQUARE_COUNT; ++square) {
+            pieces[code][square] = code == 0 ? 0 : nextKey(state);
+        }
+    }
+    for (int file = 0; file < 8; ++file) {
+        enPassant[file] = nextKey(state);
+    }
+    side = nextKey(state);
+
+    castling[0] = 0;
+    for (int right = 0; right < 4; ++right) {
+        const std::uint64_t key = nextKey(state);
+        for (int rights = 1 << right; rights < (2 << right); ++rights) {
+            castling[rights] = castling[rights & ~(1 << right)] ^ key;
+        }
+    }
+}
+
+const Zobrist::Keys& Zobrist::keys() {
+    static const Keys table;
+    return table;
+}
+
+std::uint64_t Zobrist::pieceKey(Piece::Code code, int squareIndex) {
+    return keys().pieces[static_cast<int>(code)][squareIndex];
+}
+
+std::uint64_t Zobrist::enPassantKey(int file) {
+    return keys().enPassant[file];
+}
+
+std::uint64_t Zobrist::sideKey() {
+    return keys().side;
+}
+
+std::uint64_t Zobrist::castlingKey(std::uint8_t rights) {
+    return keys().castling[rights & 15];
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+#include "pieces/Piece.hpp"
+#include <cstdint>
+
+class Zobrist {
+public:
+    static std::uint64_t pieceKey(Piece::Code code, int squareIndex);
+    static std::uint64_t enPassantKey(int file);
+    static std::uint64_t sideKey();
+    static std::uint64_t castlingKey(std::uint8_t rights);
+
+private:
+    static const int CODE_COUNT = 16;
+    static const int SQUARE_COUNT = 64;
+
+    struct Keys {
+        std::uint64_t pieces[CODE_COUNT][SQUARE_COUNT];
+        std::uint64_t enPassant[8];
+        std::uint64_t side;
+        std::uint64_t castling[16];
+
+        Keys();
+    };
+
+    static const Keys& keys();
+};
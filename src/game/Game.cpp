@@ -42,7 +42,7 @@ bool Game::makeMove(const std::string& from, const std::string& to) {
         return false;
     }
 
-    Piece* piece = fromSquare->getPiece();
+    const Piece* piece = fromSquare->getPiece();
     if (piece->getColor() != getCurrentTurn()) {
         return false;
     }
@@ -104,39 +104,6 @@ void Game::undoLastMove() {
         return;
     }
     
-    if (gameState->getMoveHistory().empty()) {
-        return;
-    }
-
-    const Move& lastMove = gameState->getMoveHistory().back();
-    Position from = lastMove.getFrom();
-    Position to = lastMove.getTo();
-
-    Square* toSquare = board->getSquare(to);
-    Piece* piece = nullptr;
-    if (toSquare && toSquare->isOccupied()) {
-        piece = toSquare->getPiece();
-    }
-
-    if (lastMove.getType() == Move::Type::Castling) {
-        const int rank = (getCurrentTurn() == Piece::Color::White) ? 0 : 7;
-        const bool isKingside = (to.getX() == 6);
-        
-        const Position rookFrom(isKingside ? 5 : 3, rank);
-        const Position rookTo(isKingside ? 7 : 0, rank);
-        board->movePiece(rookFrom, rookTo);
-        Square* rookSquare = board->getSquare(rookTo);
-        if (rookSquare && rookSquare->isOccupied()) {
-            rookSquare->getPiece()->setMoved(false);
-        }
-    }
-
-    board->movePiece(to, from);
-    Square* fromSquare = board->getSquare(from);
-    if (fromSquare && fromSquare->isOccupied()) {
-        fromSquare->getPiece()->setMoved(false);
-    }
-
     gameState->undoLastMove(board);
 }
 
@@ -209,7 +176,7 @@ bool Game::isValidMove(const std::string& from, const std::string& to) const {
         return false;
     }
 
-    Piece* piece = fromSquare->getPiece();
+    const Piece* piece = fromSquare->getPiece();
     if (piece->getColor() != getCurrentTurn()) {
         return false;
     }
@@ -266,7 +233,7 @@ bool Game::isPromotionMove(const Move& move) const {
         return false;
     }
 
-    Piece* piece = fromSquare->getPiece();
+    const Piece* piece = fromSquare->getPiece();
     if (piece->getType() != Piece::Type::Pawn) {
         return false;
     }
@@ -1,9 +1,6 @@
 #include "GameState.hpp"
+#include "board/Zobrist.hpp"
 #include "moves/MoveGenerator.hpp"
-#include "pieces/Bishop.hpp"
-#include "pieces/Knight.hpp"
-#include "pieces/Queen.hpp"
-#include "pieces/Rook.hpp"
 #include <algorithm>
 #include <sstream>
 
@@ -23,78 +20,52 @@ bool GameState::makeMove(const Move& move, Board* board) {
         return false;
     }
 
-    boardHistory.push_back(*board);
-
     const Square* fromSquare = board->getSquare(move.getFrom());
     const Square* toSquare = board->getSquare(move.getTo());
-    
-    bool isCapture = toSquare->isOccupied();
-    Piece::Type capturedType = Piece::Type::Pawn;
-    Piece::Color capturedColor = Piece::Color::White;
-    
-    if (isCapture) {
-        capturedType = toSquare->getPiece()->getType();
-        capturedColor = toSquare->getPiece()->getColor();
-    }
 
-    bool moveResult = board->movePiece(move.getFrom(), move.getTo());
-    if (!moveResult) {
-        boardHistory.pop_back();
-        return false;
+    UndoRecord undo;
+    undo.movedPiece = *fromSquare->getPiece();
+    undo.capturedPosition = move.getTo();
+    undo.enPassantPosition = board->getEnPassantPosition();
+    undo.castlingRights = board->getCastlingRights();
+    undo.halfMoveCount = halfMoveCount;
+
+    if (toSquare->isOccupied()) {
+        undo.capturedPiece = *toSquare->getPiece();
+    } else if (undo.movedPiece.getType() == Piece::Type::Pawn &&
+               move.getFrom().getX() != move.getTo().getX()) {
+        undo.capturedPosition = Position(move.getTo().getX(), move.getFrom().getY());
+        const Square* passedSquare = board->getSquare(undo.capturedPosition);
+        if (passedSquare && passedSquare->isOccupied()) {
+            undo.capturedPiece = *passedSquare->getPiece();
+        }
     }
 
-    if (move.getType() == Move::Type::EnPassant) {
-        isCapture = true;
-        capturedType = Piece::Type::Pawn;
-        capturedColor = (currentTurn == Piece::Color::White) ? 
-                       Piece::Color::Black : Piece::Color::White;
+    if (positionKeys.empty()) {
+        updatePositionHistory(board);
     }
 
-    if (move.getType() == Move::Type::Promotion) {
-        Square* square = board->getSquare(move.getTo());
-        if (square->isOccupied()) {
-            Piece* oldPiece = square->removePiece();
-            Piece* newPiece = nullptr;
-            
-            switch (move.getPromotionPiece()) {
-                case Piece::Type::Queen:
-                    newPiece = new Queen(currentTurn, move.getTo());
-                    break;
-                case Piece::Type::Rook:
-                    newPiece = new Rook(currentTurn, move.getTo());
-                    break;
-                case Piece::Type::Bishop:
-                    newPiece = new Bishop(currentTurn, move.getTo());
-                    break;
-                case Piece::Type::Knight:
-                    newPiece = new Knight(currentTurn, move.getTo());
-                    break;
-                default:
-                    delete oldPiece;
-                    return false;
-            }
-            
-            delete oldPiece;
-            square->setPiece(newPiece);
-            newPiece->setMoved(true);
-        }
+    bool moveResult = board->applyMove(move);
+    if (!moveResult) {
+        return false;
     }
 
     moveHistory.push_back(move);
+    undoStack.push_back(undo);
 
     if (currentTurn == Piece::Color::Black) {
         moveCount++;
     }
 
-    if (move.getType() == Move::Type::Capture || 
-        move.getType() == Move::Type::EnPassant ||
-        board->getSquare(move.getTo())->getPiece()->getType() == Piece::Type::Pawn) {
+    if (!undo.capturedPiece.isNone() ||
+        undo.movedPiece.getType() == Piece::Type::Pawn) {
         halfMoveCount = 0;
     } else {
         halfMoveCount++;
     }
 
     switchTurn();
+    updatePositionHistory(board);
     updateGameState(board);
     clearDrawOffer();
 
@@ -102,14 +73,37 @@ bool GameState::makeMove(const Move& move, Board* board) {
 }
 
 void GameState::undoLastMove(Board* board) {
-    if (boardHistory.empty() || !board || moveHistory.empty()) {
+    if (undoStack.empty() || !board || moveHistory.empty()) {
         return;
     }
 
-    *board = boardHistory.back();
-    boardHistory.pop_back();
-    
+    const UndoRecord& undo = undoStack.back();
+    const Move& move = moveHistory.back();
+    const Position from = move.getFrom();
+    const Position to = move.getTo();
+
+    board->removePiece(to);
+    board->placePiece(undo.movedPiece, from);
+
+    if (undo.movedPiece.getType() == Piece::Type::King &&
+        std::abs(to.getX() - from.getX()) == 2) {
+        const bool isKingside = to.getX() > from.getX();
+        Piece rook = board->removePiece(Position(isKingside ? 5 : 3, from.getY()));
+        rook.setMoved(false);
+        board->placePiece(rook, Position(isKingside ? 7 : 0, from.getY()));
+    }
+
+    if (!undo.capturedPiece.isNone()) {
+        board->placePiece(undo.capturedPiece, undo.capturedPosition);
+    }
+
+    board->setEnPassantPosition(undo.enPassantPosition);
+    board->setCastlingRights(undo.castlingRights);
+    halfMoveCount = undo.halfMoveCount;
+
+    undoStack.pop_back();
     moveHistory.pop_back();
+    positionKeys.pop_back();
     
     if (currentTurn == Piece::Color::White) {
         moveCount--;
@@ -137,6 +131,15 @@ bool GameState::isMoveLegal(const Move& move, const Board* board) const {
         }
         
         int rookFile = (move.getTo().getX() == 6) ? 7 : 0;
+        // The board's castling rights are the authority; a FEN with "-" leaves the pieces "unmoved".
+        const bool white = currentTurn == Piece::Color::White;
+        const Board::CastlingRight right = rookFile == 7
+            ? (white ? Board::WhiteKingside : Board::BlackKingside)
+            : (white ? Board::WhiteQueenside : Board::BlackQueenside);
+        if (!board->hasCastlingRight(right)) {
+            return false;
+        }
+
         Position rookPos(rookFile, move.getFrom().getY());
         const Square* rookSquare = board->getSquare(rookPos);
         
@@ -244,17 +247,16 @@ bool GameState::isInsufficientMaterial(const Board* board) const {
 }
 
 bool GameState::isThreefoldRepetition() const {
-    if (positionHistory.size() < 6) return false;
-    
-    const std::string& currentPosition = positionHistory.back();
-    int repetitions = 0;
-    
-    for (const auto& position : positionHistory) {
-        if (position == currentPosition) {
-            repetitions++;
-            if (repetitions >= 3) {
-                return true;
-            }
+    if (positionKeys.size() < 5) return false;
+
+    const int last = static_cast<int>(positionKeys.size()) - 1;
+    const int oldest = std::max(0, last - halfMoveCount);
+    const std::uint64_t currentKey = positionKeys[last];
+    int repetitions = 1;
+
+    for (int i = last - 2; i >= oldest; i -= 2) {
+        if (positionKeys[i] == currentKey && ++repetitions >= 3) {
+            return true;
         }
     }
     return false;
@@ -334,14 +336,15 @@ std::string GameState::toString() const {
     return ss.str();
 }
 
-void GameState::reset() {
-    currentTurn = Piece::Color::White;
+void GameState::reset(Piece::Color sideToMove) {
+    currentTurn = sideToMove;
     result = Result::None;
     drawReason = DrawReason::None;
     moveCount = 1;
     halfMoveCount = 0;
     moveHistory.clear();
-    positionHistory.clear();
+    undoStack.clear();
+    positionKeys.clear();
     clearDrawOffer();
 }
 
@@ -382,8 +385,11 @@ void GameState::updateGameState(Board* board) {
 
 void GameState::updatePositionHistory(const Board* board) {
     if (!board) return;
-    std::string currentPosition = board->toFEN();
-    positionHistory.push_back(currentPosition);
+    std::uint64_t key = board->getHash();
+    if (currentTurn == Piece::Color::Black) {
+        key ^= Zobrist::sideKey();
+    }
+    positionKeys.push_back(key);
 }
 
 bool GameState::isMovePossible(const Board* board) const {
@@ -1,6 +1,7 @@
 #pragma once
 #include "board/Board.hpp"
 #include "moves/Move.hpp"
+#include <cstdint>
 #include <vector>
 #include <string>
 
@@ -32,7 +33,7 @@ public:
     int getMoveCount() const { return moveCount; }
     int getHalfMoveCount() const { return halfMoveCount; }
     const std::vector<Move>& getMoveHistory() const { return moveHistory; }
-    const std::vector<std::string>& getPositionHistory() const { return positionHistory; }
+    const std::vector<std::uint64_t>& getPositionKeys() const { return positionKeys; }
 
     bool makeMove(const Move& move, Board* board);
     void undoLastMove(Board* board);
@@ -57,17 +58,28 @@ public:
     void setResult(Result newResult, DrawReason reason = DrawReason::None);
 
     std::string toString() const;
-    void reset();
+    void reset(Piece::Color sideToMove = Piece::Color::White);
 
 private:
-    std::vector<Board> boardHistory;
+    // Everything makeMove changes that cannot be recomputed from the move.
+    struct UndoRecord {
+        Piece movedPiece;
+        Piece capturedPiece;
+        Position capturedPosition;
+        Position enPassantPosition;
+        std::uint8_t castlingRights;
+        int halfMoveCount;
+    };
+
+    std::vector<UndoRecord> undoStack;
     Piece::Color currentTurn;         
     Result result;                     
     DrawReason drawReason;            
     int moveCount;                     
     int halfMoveCount;                 
     std::vector<Move> moveHistory;     
-    std::vector<std::string> positionHistory; 
+    // One key per position reached, the initial one included; undoLastMove pops it.
+    std::vector<std::uint64_t> positionKeys;
 
     bool drawOffered;                  
     Piece::Color drawOfferingColor;    
@@ -320,7 +320,7 @@ bool Console::isPromotionMove(const std::string& from, const std::string& to) co
         return false;
     }
     
-    Piece* piece = fromSquare->getPiece();
+    const Piece* piece = fromSquare->getPiece();
     if (piece->getType() != Piece::Type::Pawn) {
         return false;
     }
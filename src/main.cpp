@@ -1,6 +1,7 @@
 #include "io/Console.hpp"
 #include "game/Game.hpp"
 #include "ai/AI.hpp"
+#include "ai/Ponder.hpp"
 #include "utils/Timer.hpp"
 #include "utils/GameLogger.hpp"
 #include <iostream>
@@ -17,7 +18,8 @@ public:
         console(game.get()),
         logger(std::make_unique<GameLogger>(game.get())),
         isPlayerWhite(true),
-        timer(nullptr)
+        timer(nullptr),
+        ponderEnabled(true)
         {
         }
 
@@ -39,6 +41,8 @@ private:
     bool isPlayerWhite;
     std::unique_ptr<Timer> timer;
     std::unique_ptr<GameLogger> logger;
+    Ponder ponder;
+    bool ponderEnabled;
 
 
      void showWelcomeMessage() {
@@ -125,6 +129,7 @@ private:
 
             if (isPlayerTurn) {
                 std::cout << "\nYour turn!\n";
+                startPondering();
                 handlePlayerMove();
 
                 if (game->getCurrentTurn() == Piece::Color::White && isPlayerWhite ||
@@ -197,6 +202,7 @@ private:
 
             if (isPlayerTurn) {
                 std::cout << "\nYour turn!\n";
+                startPondering();
                 handlePlayerMove();
 
                 if (game->getCurrentTurn() == Piece::Color::White && isPlayerWhite ||
@@ -248,10 +254,10 @@ private:
             if (console.getMove(from, to)) {
                 const Square* fromSquare = game->getBoard()->getSquare(Position(from));
                 if (fromSquare && fromSquare->isOccupied()) {
-                    const Piece* piece = fromSquare->getPiece();
+                    const Piece piece = *fromSquare->getPiece();
                     const Square* toSquare = game->getBoard()->getSquare(Position(to));
                     const bool isCapture = toSquare && toSquare->isOccupied() &&
-                            toSquare->getPiece()->getColor() != piece->getColor();
+                            toSquare->getPiece()->getColor() != piece.getColor();
 
                     Piece::Type capturedType = Piece::Type::Pawn;
                     Piece::Color capturedColor = Piece::Color::White;
@@ -263,14 +269,11 @@ private:
                     if (game->makeMove(from, to)) {
                         timer->stop();
 
-                            logger->logMove(from, to, piece->getType(), piece->getColor(),
-                                            isCapture, game->isCheck(), game->isCheckmate());
-        
-                        console.addMoveToHistory(from, to, piece->getType(), 
-                                            piece->getColor(), isCapture,
+                        console.addMoveToHistory(from, to, piece.getType(), 
+                                            piece.getColor(), isCapture,
                         capturedType, capturedColor);
-                        console.addMoveToHistory(from, to, piece->getType(), 
-                                        piece->getColor(), isCapture,
+                        console.addMoveToHistory(from, to, piece.getType(), 
+                                        piece.getColor(), isCapture,
                                         capturedType, capturedColor);
                         return;
                     }
@@ -282,10 +285,19 @@ private:
     } 
     
 
+    void startPondering() {
+        if (ponderEnabled && !ponder.isRunning()) {
+            ponder.start(*game->getBoard(), game->getCurrentTurn(), ai->getDepth());
+        }
+    }
+
     void handleAIMove() {
         std::cout << "\nAI is thinking...\n";
     
-        Move aiMove = ai->getMove(game->getBoard(), game->getCurrentTurn());
+        Move aiMove;
+        if (!ponder.takeMove(*game->getBoard(), game->getCurrentTurn(), aiMove)) {
+            aiMove = ai->getMove(game->getBoard(), game->getCurrentTurn());
+        }
     
         if (aiMove.getFrom().isValid() && aiMove.getTo().isValid()) {
             const std::string from = aiMove.getFrom().toAlgebraic();
@@ -293,10 +305,10 @@ private:
         
             const Square* fromSquare = game->getBoard()->getSquare(aiMove.getFrom());
             if (fromSquare && fromSquare->isOccupied()) {
-                const Piece* piece = fromSquare->getPiece();
+                const Piece piece = *fromSquare->getPiece();
                 const Square* toSquare = game->getBoard()->getSquare(aiMove.getTo());
                 bool isCapture = toSquare && toSquare->isOccupied() && 
-                        toSquare->getPiece()->getColor() != piece->getColor();
+                        toSquare->getPiece()->getColor() != piece.getColor();
 
                 Piece::Type capturedType = Piece::Type::Pawn;
                 Piece::Color capturedColor = Piece::Color::White;
@@ -308,11 +320,8 @@ private:
                 //std::cout << "AI moves: " << from << " to " << to << "\n";
             
                 if (game->makeMove(from, to)) {
-                    logger->logMove(from, to, piece->getType(), piece->getColor(),
-                                    isCapture, game->isCheck(), game->isCheckmate());
-                        
-                console.addMoveToHistory(from, to, piece->getType(), 
-                        piece->getColor(), isCapture,
+                console.addMoveToHistory(from, to, piece.getType(), 
+                        piece.getColor(), isCapture,
                         capturedType, capturedColor);
                 console.clearScreen();
                 console.displayBoard();
@@ -335,6 +344,7 @@ private:
         }
     }
     void announceResult() {
+        ponder.stop();
         console.clearScreen();
         console.displayBoard();
         std::cout << "\n=== Game Over! ===\n";
@@ -8,9 +8,11 @@
 #include "pieces/Bishop.hpp"
 #include "pieces/Queen.hpp"
 #include "pieces/King.hpp"
+#include "utils/Profiler.hpp"
 #include <algorithm>
 
 std::vector<Move> MoveGenerator::generateAllMoves(const Board* board, Piece::Color color) {
+    PROFILE_SCOPE("MoveGenerator::generateAllMoves");
     std::vector<Move> allMoves;
     if (!board) return allMoves;
     
@@ -27,15 +29,29 @@ std::vector<Move> MoveGenerator::generateAllMoves(const Board* board, Piece::Col
 }
 
 std::vector<Move> MoveGenerator::generateLegalMoves(const Board* board, const Position& pos) {
+    PROFILE_SCOPE("MoveGenerator::generateLegalMoves");
+    std::vector<Move> moves = generatePseudoLegalMoves(board, pos);
+    if (moves.empty()) return moves;
+    
+    const Piece::Color color = board->getSquare(pos)->getPiece()->getColor();
+    Board scratch(*board);
+    const auto it = std::remove_if(moves.begin(), moves.end(),
+        [board, color, &scratch](const Move& move) {
+            return wouldResultInCheck(board, scratch, move, color);
+        });
+    moves.erase(it, moves.end());
+    
+    return moves;
+}
+
+std::vector<Move> MoveGenerator::generatePseudoLegalMoves(const Board* board, const Position& pos) {
     std::vector<Move> moves;
     if (!board) return moves;
     
     const Square* square = board->getSquare(pos);
     if (!square || !square->isOccupied()) return moves;
     
-    Piece* piece = square->getPiece();
-    
-    switch (piece->getType()) {
+    switch (square->getPiece()->getType()) {
         case Piece::Type::Pawn:
             moves = generatePawnMoves(board, pos);
             break;
@@ -56,12 +72,6 @@ std::vector<Move> MoveGenerator::generateLegalMoves(const Board* board, const Po
             break;
     }
     
-    const auto it = std::remove_if(moves.begin(), moves.end(),
-        [board, piece](const Move& move) {
-            return wouldResultInCheck(board, move, piece->getColor());
-        });
-    moves.erase(it, moves.end());
-    
     return moves;
 }
 
@@ -94,7 +104,7 @@ std::vector<Move> MoveGenerator::generatePawnMoves(const Board* board, const Pos
     const Square* square = board->getSquare(pos);
     if (!square || !square->isOccupied()) return moves;
     
-    Piece* pawn = square->getPiece();
+    const Piece* pawn = square->getPiece();
     if (pawn->getType() != Piece::Type::Pawn) return moves;
     
     int direction = (pawn->getColor() == Piece::Color::White) ? 1 : -1;
@@ -145,7 +155,7 @@ std::vector<Move> MoveGenerator::generateKnightMoves(const Board* board, const P
     const Square* square = board->getSquare(pos);
     if (!square || !square->isOccupied()) return moves;
     
-    Piece* knight = square->getPiece();
+    const Piece* knight = square->getPiece();
     const std::vector<std::pair<int, int>> offsets = {
         {-2, -1}, {-2, 1}, {-1, -2}, {-1, 2},
         {1, -2}, {1, 2}, {2, -1}, {2, 1}
@@ -171,7 +181,7 @@ std::vector<Move> MoveGenerator::generateBishopMoves(const Board* board, const P
     const Square* square = board->getSquare(pos);
     if (!square || !square->isOccupied()) return moves;
     
-    Piece* bishop = square->getPiece();
+    const Piece* bishop = square->getPiece();
     const std::vector<std::pair<int, int>> directions = {
         {-1, -1}, {-1, 1}, {1, -1}, {1, 1}
     };
@@ -201,7 +211,7 @@ std::vector<Move> MoveGenerator::generateRookMoves(const Board* board, const Pos
     const Square* square = board->getSquare(pos);
     if (!square || !square->isOccupied()) return moves;
     
-    Piece* rook = square->getPiece();
+    const Piece* rook = square->getPiece();
     const std::vector<std::pair<int, int>> directions = {
         {0, 1}, {0, -1}, {1, 0}, {-1, 0}
     };
@@ -243,7 +253,7 @@ std::vector<Move> MoveGenerator::generateKingMoves(const Board* board, const Pos
     const Square* square = board->getSquare(pos);
     if (!square || !square->isOccupied()) return moves;
     
-    Piece* king = square->getPiece();
+    const Piece* king = square->getPiece();
     const std::vector<std::pair<int, int>> directions = {
         {-1, -1}, {-1, 0}, {-1, 1},
         {0, -1},           {0, 1},
@@ -281,7 +291,12 @@ std::vector<Move> MoveGenerator::getCastlingMoves(const Board* board, Piece::Col
     const Square* kingSquare = board->getSquare(kingPos);
     if (!kingSquare || !kingSquare->isOccupied()) return moves;
     
-    Piece* king = kingSquare->getPiece();
+    const std::uint8_t colorRights = color == Piece::Color::White
+        ? Board::WhiteKingside | Board::WhiteQueenside
+        : Board::BlackKingside | Board::BlackQueenside;
+    if (!(board->getCastlingRights() & colorRights)) return moves;
+
+    const Piece* king = kingSquare->getPiece();
     if (king->getType() != Piece::Type::King || 
         king->hasMoved() || 
         board->isCheck(color)) {
@@ -301,6 +316,9 @@ std::vector<Move> MoveGenerator::getCastlingMoves(const Board* board, Piece::Col
 
 bool MoveGenerator::canCastleKingside(const Board* board, Piece::Color color) {
     if (!board) return false;
+    if (!board->hasCastlingRight(color == Piece::Color::White ? Board::WhiteKingside : Board::BlackKingside)) {
+        return false;
+    }
     
     int rank = (color == Piece::Color::White) ? 0 : 7;
     const Position kingPos(4, rank);
@@ -314,11 +332,10 @@ bool MoveGenerator::canCastleKingside(const Board* board, Piece::Color color) {
         return false;
     }
     
-    Piece* king = kingSquare->getPiece();
-    Piece* rook = rookSquare->getPiece();
+    const Piece* king = kingSquare->getPiece();
+    const Piece* rook = rookSquare->getPiece();
     
-    if (king->hasMoved() || rook->hasMoved() ||
-        king->getType() != Piece::Type::King ||
+    if (king->getType() != Piece::Type::King ||
         rook->getType() != Piece::Type::Rook ||
         rook->getColor() != color) {
         return false;
@@ -337,6 +354,9 @@ bool MoveGenerator::canCastleKingside(const Board* board, Piece::Color color) {
 
 bool MoveGenerator::canCastleQueenside(const Board* board, Piece::Color color) {
     if (!board) return false;
+    if (!board->hasCastlingRight(color == Piece::Color::White ? Board::WhiteQueenside : Board::BlackQueenside)) {
+        return false;
+    }
     
     int rank = (color == Piece::Color::White) ? 0 : 7;
     Position kingPos(4, rank);
@@ -350,11 +370,10 @@ bool MoveGenerator::canCastleQueenside(const Board* board, Piece::Color color) {
         return false;
     }
     
-    Piece* king = kingSquare->getPiece();
-    Piece* rook = rookSquare->getPiece();
+    const Piece* king = kingSquare->getPiece();
+    const Piece* rook = rookSquare->getPiece();
     
-    if (king->hasMoved() || rook->hasMoved() ||
-        king->getType() != Piece::Type::King ||
+    if (king->getType() != Piece::Type::King ||
         rook->getType() != Piece::Type::Rook ||
         rook->getColor() != color) {
         return false;
@@ -422,7 +441,7 @@ bool MoveGenerator::isPawnPromotion(const Board* board, const Position& from, co
     const Square* fromSquare = board->getSquare(from);
     if (!fromSquare || !fromSquare->isOccupied()) return false;
     
-    Piece* piece = fromSquare->getPiece();
+    const Piece* piece = fromSquare->getPiece();
     if (piece->getType() != Piece::Type::Pawn) return false;
     
     int promotionRank = (piece->getColor() == Piece::Color::White) ? 7 : 0;
@@ -433,7 +452,7 @@ bool MoveGenerator::isEnPassantPossible(const Board* board, const Position& from
     const Square* fromSquare = board->getSquare(from);
     if (!fromSquare || !fromSquare->isOccupied()) return false;
     
-    Piece* piece = fromSquare->getPiece();
+    const Piece* piece = fromSquare->getPiece();
     if (piece->getType() != Piece::Type::Pawn) return false;
     
     if (to != board->getEnPassantPosition()) return false;
@@ -444,28 +463,13 @@ bool MoveGenerator::isEnPassantPossible(const Board* board, const Position& from
 
 bool MoveGenerator::wouldResultInCheck(const Board* board, const Move& move, Piece::Color color) {
     Board tempBoard(*board);
-    tempBoard.movePiece(move.getFrom(), move.getTo());
-    return tempBoard.isCheck(color);
+    return wouldResultInCheck(board, tempBoard, move, color);
 }
 
-void MoveGenerator::updateCastlingRights(const Move& move) {
-    if (move.getType() == Move::Type::Castling) {
-        castlingRights.removeCastlingRights(
-            move.getFrom().getY() == 0 ? Piece::Color::White : Piece::Color::Black
-        );
-        return;
-    }
-    
-    const Position& from = move.getFrom();
-    const Position& to = move.getTo();
-    
-    if (from == Position(0, 0) || to == Position(0, 0)) castlingRights.queensideWhite = false;
-    if (from == Position(7, 0) || to == Position(7, 0)) castlingRights.kingsideWhite = false;
-    if (from == Position(0, 7) || to == Position(0, 7)) castlingRights.queensideBlack = false;
-    if (from == Position(7, 7) || to == Position(7, 7)) castlingRights.kingsideBlack = false;
-    
-    if (from == Position(4, 0)) castlingRights.removeCastlingRights(Piece::Color::White);
-    if (from == Position(4, 7)) castlingRights.removeCastlingRights(Piece::Color::Black);
+bool MoveGenerator::wouldResultInCheck(const Board* board, Board& scratch, const Move& move, Piece::Color color) {
+    scratch = *board;
+    scratch.movePiece(move.getFrom(), move.getTo());
+    return scratch.isCheck(color);
 }
 
 Piece::Color MoveGenerator::getOppositeColor(Piece::Color color) {
@@ -7,45 +7,23 @@
 
 class MoveGenerator {
 public:
-    struct CastlingRights {
-        bool kingsideWhite = true;
-        bool queensideWhite = true;
-        bool kingsideBlack = true;
-        bool queensideBlack = true;
-        
-        void reset() {
-            kingsideWhite = queensideWhite = kingsideBlack = queensideBlack = true;
-        }
-        
-        void removeCastlingRights(Piece::Color color) {
-            if (color == Piece::Color::White) {
-                kingsideWhite = queensideWhite = false;
-            } else {
-                kingsideBlack = queensideBlack = false;
-            }
-        }
-    };
-
-    MoveGenerator() { castlingRights.reset(); }
-
     static std::vector<Move> generateAllMoves(const Board* board, Piece::Color color);
     static std::vector<Move> generateLegalMoves(const Board* board, const Position& pos);
+    // Moves of the piece on `pos` without the own-king-in-check filter.
+    static std::vector<Move> generatePseudoLegalMoves(const Board* board, const Position& pos);
     static std::vector<Move> generateCaptureMoves(const Board* board, Piece::Color color);
     
     static bool isMoveLegal(const Board* board, const Move& move);
+    // Reuses the caller's scratch board, assignment keeps its square storage.
+    static bool wouldResultInCheck(const Board* board, Board& scratch, const Move& move, Piece::Color color);
     
     static std::vector<Move> getCastlingMoves(const Board* board, Piece::Color color);
     static bool canCastleKingside(const Board* board, Piece::Color color);
     static bool canCastleQueenside(const Board* board, Piece::Color color);
     
     static std::vector<Move> getPromotionMoves(const Board* board, const Position& from, const Position& to);
-    
-    const CastlingRights& getCastlingRights() const { return castlingRights; }
-    void updateCastlingRights(const Move& move);
 
 private:
-    CastlingRights castlingRights;
-
     static std::vector<Move> generatePawnMoves(const Board* board, const Position& pos);
     static std::vector<Move> generateKnightMoves(const Board* board, const Position& pos);
     static std::vector<Move> generateBishopMoves(const Board* board, const Position& pos);
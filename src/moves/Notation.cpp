@@ -0,0 +1,189 @@
+#include "Notation.hpp"
+#include "moves/MoveGenerator.hpp"
+#include <cstdlib>
+
+namespace {
+bool isCastling(const Board& board, const Move& move) {
+    const Square* square = board.getSquare(move.getFrom());
+    return square && square->isOccupied() &&
+           square->getPiece()->getType() == Piece::Type::King &&
+           std::abs(move.getTo().getX() - move.getFrom().getX()) == 2;
+}
+
+bool pieceFromLetter(char letter, Piece::Type& type) {
+    switch (letter) {
+        case 'N': type = Piece::Type::Knight; return true;
+        case 'B': type = Piece::Type::Bishop; return true;
+        case 'R': type = Piece::Type::Rook; return true;
+        case 'Q': type = Piece::Type::Queen; return true;
+        case 'K': type = Piece::Type::King; return true;
+        default: return false;
+    }
+}
+}
+
+char Notation::pieceLetter(Piece::Type type) {
+    switch (type) {
+        case Piece::Type::Knight: return 'N';
+        case Piece::Type::Bishop: return 'B';
+        case Piece::Type::Rook:   return 'R';
+        case Piece::Type::Queen:  return 'Q';
+        case Piece::Type::King:   return 'K';
+        default:                  return 'P';
+    }
+}
+
+std::string Notation::toSan(const Board& board, Piece::Color color, const Move& move) {
+    const Square* fromSquare = board.getSquare(move.getFrom());
+    const Square* toSquare = board.getSquare(move.getTo());
+    if (!fromSquare || !toSquare || !fromSquare->isOccupied()) {
+        return "";
+    }
+
+    const Piece::Type type = fromSquare->getPiece()->getType();
+    std::string san;
+
+    if (isCastling(board, move)) {
+        san = move.getTo().getX() > move.getFrom().getX() ? "O-O" : "O-O-O";
+    } else {
+        const bool isCapture = toSquare->isOccupied() ||
+            (type == Piece::Type::Pawn && move.getFrom().getX() != move.getTo().getX());
+
+        if (type == Piece::Type::Pawn) {
+            if (isCapture) {
+                san += static_cast<char>('a' + move.getFrom().getX());
+            }
+        } else {
+            san += pieceLetter(type);
+
+            bool ambiguous = false;
+            bool sameFile = false;
+            bool sameRank = false;
+            for (const Move& other : MoveGenerator::generateAllMoves(&board, color)) {
+                if (other.getTo() != move.getTo() || other.getFrom() == move.getFrom() ||
+                    board.getSquare(other.getFrom())->getPiece()->getType() != type) {
+                    continue;
+                }
+                ambiguous = true;
+                sameFile = sameFile || other.getFrom().getX() == move.getFrom().getX();
+                sameRank = sameRank || other.getFrom().getY() == move.getFrom().getY();
+            }
+            if (ambiguous) {
+                const std::string from = move.getFrom().toAlgebraic();
+                if (!sameFile) {
+                    san += from[0];
+                } else if (!sameRank) {
+                    san += from[1];
+                } else {
+                    san += from;
+                }
+            }
+        }
+
+        if (isCapture) {
+            san += 'x';
+        }
+        san += move.getTo().toAlgebraic();
+
+        if (move.getType() == Move::Type::Promotion) {
+            san += '=';
+            san += pieceLetter(move.getPromotionPiece());
+        }
+    }
+
+    Board after(board);
+    if (after.applyMove(move)) {
+        const Piece::Color opponent = color == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
+        if (after.isCheck(opponent)) {
+            san += MoveGenerator::generateAllMoves(&after, opponent).empty() ? '#' : '+';
+        }
+    }
+    return san;
+}
+
+bool Notation::parseSan(const Board& board, Piece::Color color, const std::string& san, Move& move) {
+    std::string text = san;
+    while (!text.empty() && std::string("+#!?").find(text.back()) != std::string::npos) {
+        text.pop_back();
+    }
+    if (text.empty()) {
+        return false;
+    }
+
+    if (text == "O-O" || text == "0-0" || text == "O-O-O" || text == "0-0-0") {
+        const int targetFile = text.size() == 3 ? 6 : 2;
+        for (const Move& candidate : MoveGenerator::getCastlingMoves(&board, color)) {
+            if (candidate.getTo().getX() == targetFile) {
+                move = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Piece::Type type = Piece::Type::Pawn;
+    std::size_t start = 0;
+    if (pieceFromLetter(text[0], type)) {
+        start = 1;
+    }
+
+    bool isPromotion = false;
+    Piece::Type promotion = Piece::Type::Queen;
+    if (text.size() >= 2 && pieceFromLetter(text.back(), promotion)) {
+        isPromotion = true;
+        text.pop_back();
+        if (text.back() == '=') {
+            text.pop_back();
+        }
+    }
+
+    if (text.size() < start + 2) {
+        return false;
+    }
+    const Position to(text.substr(text.size() - 2));
+    if (!to.isValid()) {
+        return false;
+    }
+
+    int fromFile = -1;
+    int fromRank = -1;
+    for (std::size_t i = start; i < text.size() - 2; ++i) {
+        const char c = text[i];
+        if (c >= 'a' && c <= 'h') {
+            fromFile = c - 'a';
+        } else if (c >= '1' && c <= '8') {
+            fromRank = c - '1';
+        } else if (c != 'x' && c != '-' && c != ':') {
+            return false;
+        }
+    }
+
+    // Only pieces of the named type that can reach the target pseudo-legally are
+    // candidates; the king-safety check then runs on those few moves alone.
+    int matches = 0;
+    Board scratch(board);
+    for (const Piece* piece : board.getPieces(color)) {
+        const Position from = piece->getPosition();
+        if (piece->getType() != type ||
+            (fromFile >= 0 && from.getX() != fromFile) ||
+            (fromRank >= 0 && from.getY() != fromRank)) {
+            continue;
+        }
+        for (const Move& candidate : MoveGenerator::generatePseudoLegalMoves(&board, from)) {
+            if (candidate.getTo() != to || isCastling(board, candidate)) {
+                continue;
+            }
+            const bool candidatePromotes = candidate.getType() == Move::Type::Promotion;
+            if (candidatePromotes != isPromotion ||
+                (isPromotion && candidate.getPromotionPiece() != promotion) ||
+                MoveGenerator::wouldResultInCheck(&board, scratch, candidate, color)) {
+                continue;
+            }
+            if (matches == 0 || candidate != move) {
+                matches++;
+            }
+            move = candidate;
+        }
+    }
+    return matches == 1;
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include "board/Board.hpp"
+#include "moves/Move.hpp"
+#include <string>
+
+// Standard Algebraic Notation. Parsing resolves the SAN against pseudo-legal moves
+// of the named piece type and checks legality only for the moves that match.
+class Notation {
+public:
+    static std::string toSan(const Board& board, Piece::Color color, const Move& move);
+    // Accepts check/annotation suffixes and "0-0" castling; fails on ambiguous input.
+    static bool parseSan(const Board& board, Piece::Color color, const std::string& san, Move& move);
+
+    static char pieceLetter(Piece::Type type);
+};
@@ -8,6 +8,10 @@ Bishop::Bishop(Color color, Position position)
     : Piece(color, Type::Bishop, position) {
 }
 
+Bishop::Bishop(const Piece& piece)
+    : Piece(piece) {
+}
+
 std::vector<Position> Bishop::getPossibleMoves(const Board* board) const {
     std::vector<Position> moves;
     if (!board) return moves;
@@ -25,7 +29,7 @@ std::vector<Position> Bishop::getPossibleMoves(const Board* board) const {
                 if (!targetSquare->isOccupied()) {
                     moves.push_back(current);
                 } else {
-                    if (targetSquare->getPiece()->getColor() != color) {
+                    if (targetSquare->getPiece()->getColor() != getColor()) {
                         moves.push_back(current);
                     }
                     break;
@@ -41,7 +45,7 @@ std::vector<Position> Bishop::getPossibleMoves(const Board* board) const {
                 if (!targetSquare->isOccupied()) {
                     moves.push_back(current);
                 } else {
-                    if (targetSquare->getPiece()->getColor() != color) {
+                    if (targetSquare->getPiece()->getColor() != getColor()) {
                         moves.push_back(current);
                     }
                     break;
@@ -65,11 +69,11 @@ std::vector<Position> Bishop::getPossibleMoves(const Board* board) const {
             const Square* targetSquare = board->getSquare(current);
             tempBoard = *board;
             tempBoard.movePiece(position, current);
-            if (!tempBoard.isCheck(color == Color::White ? Color::Black : Color::White)) {
+            if (!tempBoard.isCheck(getColor() == Color::White ? Color::Black : Color::White)) {
                 if (!targetSquare->isOccupied()) {
                     moves.push_back(current);
                 } else {
-                    if (targetSquare->getPiece()->getColor() != color) {
+                    if (targetSquare->getPiece()->getColor() != getColor()) {
                         moves.push_back(current);
                     }
                     break;
@@ -101,15 +105,7 @@ bool Bishop::canMoveTo(const Position& target, const Board* board) const {
 
     const Square* targetSquare = board->getSquare(target);
     return !targetSquare->isOccupied() || 
-           targetSquare->getPiece()->getColor() != color;
-}
-
-char Bishop::getSymbol() const {
-    return color == Color::White ? 'B' : 'b';
-}
-
-Piece* Bishop::clone() const {
-    return new Bishop(*this);
+           targetSquare->getPiece()->getColor() != getColor();
 }
 
 bool Bishop::isValidBishopMove(const Position& target) const {
@@ -9,6 +9,10 @@ King::King(Color color, Position position)
     : Piece(color, Type::King, position) {
 }
 
+King::King(const Piece& piece)
+    : Piece(piece) {
+}
+
 std::vector<Position> King::getPossibleMoves(const Board* board) const {
     if (!board) {
         return std::vector<Position>();
@@ -21,7 +25,7 @@ std::vector<Position> King::getPossibleMoves(const Board* board) const {
         {1, -1},  {1, 0},  {1, 1}
     };
 
-    Piece::Color opponentColor = (color == Color::White) ? Color::Black : Color::White;
+    Piece::Color opponentColor = (getColor() == Color::White) ? Color::Black : Color::White;
 
     for (const auto& move : kingOffsets) {
         Position newPos = position + Position(move.first, move.second);
@@ -31,7 +35,7 @@ std::vector<Position> King::getPossibleMoves(const Board* board) const {
         
         if (!board->isPositionAttacked(newPos, opponentColor)) {
             if (!targetSquare->isOccupied() || 
-                targetSquare->getPiece()->getColor() != color) {
+                targetSquare->getPiece()->getColor() != getColor()) {
                 
                 if (targetSquare->isOccupied() && 
                     targetSquare->getPiece()->getColor() == opponentColor) {
@@ -45,7 +49,10 @@ std::vector<Position> King::getPossibleMoves(const Board* board) const {
         }
     }
 
-    if (!moved && !board->isCheck(color)) {
+    const std::uint8_t colorRights = getColor() == Color::White
+        ? Board::WhiteKingside | Board::WhiteQueenside
+        : Board::BlackKingside | Board::BlackQueenside;
+    if (!moved && (board->getCastlingRights() & colorRights) && !board->isCheck(getColor())) {
         if (canCastleKingside(board)) {
             moves.push_back(Position(position.getX() + 2, position.getY()));
         }
@@ -90,7 +97,7 @@ bool King::canMoveTo(const Position& target, const Board* board) const {
     if (dx > 2 || dy > 1) return false;
     if (dx == 2 && dy != 0) return false;
     
-    if (dx == 2 && !moved && !board->isCheck(color)) {
+    if (dx == 2 && !moved && !board->isCheck(getColor())) {
         int rookX = target.getX() > position.getX() ? 7 : 0;
         Position rookPos(rookX, position.getY());
         const Square* rookSquare = board->getSquare(rookPos);
@@ -105,11 +112,11 @@ bool King::canMoveTo(const Position& target, const Board* board) const {
 
     const Square* targetSquare = board->getSquare(target);
 
-    if (targetSquare->isOccupied() && targetSquare->getPiece()->getColor() == color) {
+    if (targetSquare->isOccupied() && targetSquare->getPiece()->getColor() == getColor()) {
         return false;
     }
 
-    Piece::Color opponentColor = (color == Color::White) ? Color::Black : Color::White;
+    Piece::Color opponentColor = (getColor() == Color::White) ? Color::Black : Color::White;
     
     if (board->isPositionAttacked(target, opponentColor)) {
         if (targetSquare->isOccupied() && targetSquare->getPiece()->getColor() == opponentColor) {
@@ -124,14 +131,6 @@ bool King::canMoveTo(const Position& target, const Board* board) const {
     return true;
 }
 
-char King::getSymbol() const {
-    return color == Color::White ? 'K' : 'k';
-}
-
-Piece* King::clone() const {
-    return new King(*this);
-}
-
 bool King::isValidKingMove(const Position& target) const {
     int dx = std::abs(target.getX() - position.getX());
     int dy = std::abs(target.getY() - position.getY());
@@ -140,9 +139,9 @@ bool King::isValidKingMove(const Position& target) const {
 
 std::vector<Position> King::getCastlingMoves(const Board* board) const {
     std::vector<Position> moves;
-    if (moved || board->isCheck(color)) return moves;
+    if (moved || board->isCheck(getColor())) return moves;
 
-    int baseRank = (color == Color::White) ? 0 : 7;
+    int baseRank = (getColor() == Color::White) ? 0 : 7;
 
     if (canCastleKingside(board)) {
         moves.push_back(Position(6, baseRank));
@@ -156,20 +155,23 @@ std::vector<Position> King::getCastlingMoves(const Board* board) const {
 }
 
 bool King::canCastleKingside(const Board* board) const {
-    int baseRank = (color == Color::White) ? 0 : 7;
+    if (!board->hasCastlingRight(getColor() == Color::White ? Board::WhiteKingside : Board::BlackKingside)) {
+        return false;
+    }
+
+    int baseRank = (getColor() == Color::White) ? 0 : 7;
     Position rookPos(7, baseRank);
     
     const Square* rookSquare = board->getSquare(rookPos);
-    if (!rookSquare->isOccupied() || 
-        rookSquare->getPiece()->getType() != Type::Rook ||
-        rookSquare->getPiece()->hasMoved()) {
+    if (position != Position(4, baseRank) || !rookSquare->isOccupied() || 
+        rookSquare->getPiece()->getType() != Type::Rook) {
         return false;
     }
 
     for (int x = position.getX() + 1; x < rookPos.getX(); x++) {
         Position pos(x, baseRank);
         if (board->getSquare(pos)->isOccupied()) return false;
-        if (board->isPositionAttacked(pos, color == Color::White ? Color::Black : Color::White)) {
+        if (board->isPositionAttacked(pos, getColor() == Color::White ? Color::Black : Color::White)) {
             return false;
         }
     }
@@ -178,20 +180,23 @@ bool King::canCastleKingside(const Board* board) const {
 }
 
 bool King::canCastleQueenside(const Board* board) const {
-    int baseRank = (color == Color::White) ? 0 : 7;
+    if (!board->hasCastlingRight(getColor() == Color::White ? Board::WhiteQueenside : Board::BlackQueenside)) {
+        return false;
+    }
+
+    int baseRank = (getColor() == Color::White) ? 0 : 7;
     Position rookPos(0, baseRank);
     
     const Square* rookSquare = board->getSquare(rookPos);
-    if (!rookSquare->isOccupied() || 
-        rookSquare->getPiece()->getType() != Type::Rook ||
-        rookSquare->getPiece()->hasMoved()) {
+    if (position != Position(4, baseRank) || !rookSquare->isOccupied() || 
+        rookSquare->getPiece()->getType() != Type::Rook) {
         return false;
     }
 
     for (int x = position.getX() - 1; x > rookPos.getX(); x--) {
         Position pos(x, baseRank);
         if (board->getSquare(pos)->isOccupied()) return false;
-        if (board->isPositionAttacked(pos, color == Color::White ? Color::Black : Color::White)) {
+        if (board->isPositionAttacked(pos, getColor() == Color::White ? Color::Black : Color::White)) {
             if (x == 1) continue; 
             return false;
         }
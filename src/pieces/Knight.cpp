@@ -8,6 +8,10 @@ Knight::Knight(Color color, Position position)
     : Piece(color, Type::Knight, position) {
 }
 
+Knight::Knight(const Piece& piece)
+    : Piece(piece) {
+}
+
 std::vector<Position> Knight::getPossibleMoves(const Board* board) const {
     std::vector<Position> moves;
     if (!board) return moves;
@@ -22,16 +26,17 @@ std::vector<Position> Knight::getPossibleMoves(const Board* board) const {
         {1, -2}, {1, 2}, {2, -1}, {2, 1}
     };
 
+    Board tempBoard(*board);
     for (const auto& move : knightOffsets) {
         Position newPos = position + Position(move.first, move.second);
         if (!board->isPositionValid(newPos)) continue;
 
         const Square* targetSquare = board->getSquare(newPos);
         if (!targetSquare->isOccupied() || 
-            targetSquare->getPiece()->getColor() != color) {
-            Board tempBoard(*board);
+            targetSquare->getPiece()->getColor() != getColor()) {
+            tempBoard = *board;
             tempBoard.movePiece(position, newPos);
-            if (!tempBoard.isCheck(color)) {
+            if (!tempBoard.isCheck(getColor())) {
                 moves.push_back(newPos);
             }
         }
@@ -55,20 +60,12 @@ bool Knight::canMoveTo(const Position& target, const Board* board) const {
 
     const Square* targetSquare = board->getSquare(target);
     if (targetSquare->isOccupied()) {
-        return targetSquare->getPiece()->getColor() != color;
+        return targetSquare->getPiece()->getColor() != getColor();
     }
 
     return true;
 }
 
-char Knight::getSymbol() const {
-    return color == Color::White ? 'N' : 'n';
-}
-
-Piece* Knight::clone() const {
-    return new Knight(*this);
-}
-
 bool Knight::isValidKnightMove(const Position& target) const {
     int dx = std::abs(target.getX() - position.getX());
     int dy = std::abs(target.getY() - position.getY());
@@ -6,12 +6,11 @@ class Knight : public Piece {
 public:
     Knight(Color color);
     Knight(Color color, Position position);
+    explicit Knight(const Piece& piece);
     
-    std::vector<Position> getPossibleMoves(const Board* board) const override;
-    std::vector<Position> getAttackedSquares(const Board* board) const override;
-    bool canMoveTo(const Position& target, const Board* board) const override;
-    char getSymbol() const override;
-    Piece* clone() const override;
+    std::vector<Position> getPossibleMoves(const Board* board) const;
+    std::vector<Position> getAttackedSquares(const Board* board) const;
+    bool canMoveTo(const Position& target, const Board* board) const;
 
 private:
     bool isValidKnightMove(const Position& target) const;
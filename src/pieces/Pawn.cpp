@@ -8,11 +8,15 @@ Pawn::Pawn(Color color, Position position)
     : Piece(color, Type::Pawn, position) {
 }
 
+Pawn::Pawn(const Piece& piece)
+    : Piece(piece) {
+}
+
 std::vector<Position> Pawn::getPossibleMoves(const Board* board) const {
     std::vector<Position> moves;
     if (!board) return moves;
 
-    int direction = (color == Color::White) ? 1 : -1;
+    int direction = (getColor() == Color::White) ? 1 : -1;
     auto pinInfo = checkIfPinned(board);
     
     if (pinInfo.isPinned) {
@@ -35,7 +39,7 @@ std::vector<Position> Pawn::getPossibleMoves(const Board* board) const {
                               position.getY() + direction);
             if (board->isPositionValid(capturePos)) {
                 const Square* square = board->getSquare(capturePos);
-                if ((square->isOccupied() && square->getPiece()->getColor() != color) ||
+                if ((square->isOccupied() && square->getPiece()->getColor() != getColor()) ||
                     capturePos == board->getEnPassantPosition()) {
                     moves.push_back(capturePos);
                 }
@@ -62,7 +66,7 @@ std::vector<Position> Pawn::getPossibleMoves(const Board* board) const {
 
         const Square* square = board->getSquare(capturePos);
         // Обычное взятие
-        if (square->isOccupied() && square->getPiece()->getColor() != color) {
+        if (square->isOccupied() && square->getPiece()->getColor() != getColor()) {
             moves.push_back(capturePos);
         }
         // Взятие на проходе
@@ -72,10 +76,11 @@ std::vector<Position> Pawn::getPossibleMoves(const Board* board) const {
     }
 
     std::vector<Position> legalMoves;
+    Board tempBoard(*board);
     for (const auto& move : moves) {
-        Board tempBoard(*board);
+        tempBoard = *board;
         tempBoard.movePiece(position, move);
-        if (!tempBoard.isCheck(color)) {
+        if (!tempBoard.isCheck(getColor())) {
             legalMoves.push_back(move);
         }
     }
@@ -116,14 +121,6 @@ bool Pawn::canMoveTo(const Position& target, const Board* board) const {
     return false;
 }
 
-char Pawn::getSymbol() const {
-    return color == Color::White ? 'P' : 'p';
-}
-
-Piece* Pawn::clone() const {
-    return new Pawn(*this);
-}
-
 bool Pawn::canBePromoted() const {
     return position.getY() == getPromotionRank();
 }
@@ -133,7 +130,7 @@ bool Pawn::isEnPassantPossible(const Position& target, const Board* board) const
         return false;
     }
 
-    int expectedRank = (color == Color::White) ? 4 : 3;
+    int expectedRank = (getColor() == Color::White) ? 4 : 3;
     if (position.getY() != expectedRank) {
         return false;
     }
@@ -150,8 +147,8 @@ bool Pawn::isEnPassantPossible(const Position& target, const Board* board) const
         return false;
     }
 
-    Piece* enemyPiece = enemySquare->getPiece();
-    if (enemyPiece->getType() != Type::Pawn || enemyPiece->getColor() == color) {
+    const Piece* enemyPiece = enemySquare->getPiece();
+    if (enemyPiece->getType() != Type::Pawn || enemyPiece->getColor() == getColor()) {
         return false;
     }
 
@@ -187,7 +184,7 @@ std::vector<Position> Pawn::getCaptureMoves(const Board* board) const {
     
     if (leftCapture.isValid()) {
         const Square* square = board->getSquare(leftCapture);
-        if (square->isOccupied() && square->getPiece()->getColor() != color) {
+        if (square->isOccupied() && square->getPiece()->getColor() != getColor()) {
             moves.push_back(leftCapture);
         }
         else if (leftCapture == board->getEnPassantPosition()) {
@@ -197,7 +194,7 @@ std::vector<Position> Pawn::getCaptureMoves(const Board* board) const {
     
     if (rightCapture.isValid()) {
         const Square* square = board->getSquare(rightCapture);
-        if (square->isOccupied() && square->getPiece()->getColor() != color) {
+        if (square->isOccupied() && square->getPiece()->getColor() != getColor()) {
             moves.push_back(rightCapture);
         }
         else if (rightCapture == board->getEnPassantPosition()) {
@@ -210,13 +207,13 @@ std::vector<Position> Pawn::getCaptureMoves(const Board* board) const {
 
 
 int Pawn::getDirection() const {
-    return (color == Color::White) ? 1 : -1;
+    return (getColor() == Color::White) ? 1 : -1;
 }
 
 int Pawn::getStartRank() const {
-    return (color == Color::White) ? 1 : 6;
+    return (getColor() == Color::White) ? 1 : 6;
 }
 
 int Pawn::getPromotionRank() const {
-    return (color == Color::White) ? 7 : 0;
+    return (getColor() == Color::White) ? 7 : 0;
 }
\ No newline at end of file
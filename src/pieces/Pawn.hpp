@@ -7,12 +7,11 @@ class Pawn : public Piece {
 public:
     Pawn(Color color);
     Pawn(Color color, Position position);
+    explicit Pawn(const Piece& piece);
     
-    std::vector<Position> getPossibleMoves(const Board* board) const override;
-    std::vector<Position> getAttackedSquares(const Board* board) const override;
-    bool canMoveTo(const Position& target, const Board* board) const override;
-    char getSymbol() const override;
-    Piece* clone() const override;
+    std::vector<Position> getPossibleMoves(const Board* board) const;
+    std::vector<Position> getAttackedSquares(const Board* board) const;
+    bool canMoveTo(const Position& target, const Board* board) const;
 
     bool canBePromoted() const;
     bool isEnPassantPossible(const Position& target, const Board* board) const;
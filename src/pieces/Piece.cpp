@@ -1,40 +1,45 @@
 #include "Piece.hpp"
+#include "Pawn.hpp"
+#include "Knight.hpp"
+#include "Bishop.hpp"
+#include "Rook.hpp"
+#include "Queen.hpp"
+#include "King.hpp"
 #include "board/Board.hpp"
 #include "board/Square.hpp"
 #include <algorithm>
 
+Piece::Piece()
+    : position(0, 0)
+    , code(Code::None)
+    , moved(false)
+{
+}
+
 Piece::Piece(Color color, Type type)
-    : color(color)
-    , type(type)
-    , position(0, 0)  
+    : position(0, 0)
+    , code(makeCode(color, type))
     , moved(false)
-    , value(0)
 {
-    switch (type) {
-        case Type::Pawn:   value = 1; break;
-        case Type::Knight: value = 3; break;
-        case Type::Bishop: value = 3; break;
-        case Type::Rook:   value = 5; break;
-        case Type::Queen:  value = 9; break;
-        case Type::King:   value = 0; break;
-    }
 }
 
 Piece::Piece(Color color, Type type, Position position)
-    : color(color)
-    , type(type)
-    , position(position)
+    : position(position)
+    , code(makeCode(color, type))
     , moved(false)
-    , value(0)
 {
-    switch (type) {
-        case Type::Pawn:   value = 1; break;
-        case Type::Knight: value = 3; break;
-        case Type::Bishop: value = 3; break;
-        case Type::Rook:   value = 5; break;
-        case Type::Queen:  value = 9; break;
-        case Type::King:   value = 0; break;
+}
+
+int Piece::getValue() const {
+    switch (getType()) {
+        case Type::Pawn:   return 1;
+        case Type::Knight: return 3;
+        case Type::Bishop: return 3;
+        case Type::Rook:   return 5;
+        case Type::Queen:  return 9;
+        case Type::King:   return 0;
     }
+    return 0;
 }
 
 void Piece::setPosition(const Position& newPosition) {
@@ -44,6 +49,49 @@ void Piece::setPosition(const Position& newPosition) {
     }
 }
 
+std::vector<Position> Piece::getPossibleMoves(const Board* board) const {
+    switch (getType()) {
+        case Type::Pawn:   return Pawn(*this).getPossibleMoves(board);
+        case Type::Knight: return Knight(*this).getPossibleMoves(board);
+        case Type::Bishop: return Bishop(*this).getPossibleMoves(board);
+        case Type::Rook:   return Rook(*this).getPossibleMoves(board);
+        case Type::Queen:  return Queen(*this).getPossibleMoves(board);
+        case Type::King:   return King(*this).getPossibleMoves(board);
+    }
+    return std::vector<Position>();
+}
+
+std::vector<Position> Piece::getAttackedSquares(const Board* board) const {
+    switch (getType()) {
+        case Type::Pawn:   return Pawn(*this).getAttackedSquares(board);
+        case Type::Knight: return Knight(*this).getAttackedSquares(board);
+        case Type::Bishop: return Bishop(*this).getAttackedSquares(board);
+        case Type::Rook:   return Rook(*this).getAttackedSquares(board);
+        case Type::Queen:  return Queen(*this).getAttackedSquares(board);
+        case Type::King:   return King(*this).getAttackedSquares(board);
+    }
+    return std::vector<Position>();
+}
+
+bool Piece::canMoveTo(const Position& target, const Board* board) const {
+    switch (getType()) {
+        case Type::Pawn:   return Pawn(*this).canMoveTo(target, board);
+        case Type::Knight: return Knight(*this).canMoveTo(target, board);
+        case Type::Bishop: return Bishop(*this).canMoveTo(target, board);
+        case Type::Rook:   return Rook(*this).canMoveTo(target, board);
+        case Type::Queen:  return Queen(*this).canMoveTo(target, board);
+        case Type::King:   return King(*this).canMoveTo(target, board);
+    }
+    return false;
+}
+
+char Piece::getSymbol() const {
+    static const char SYMBOLS[] = "PNBRQK";
+    if (isNone()) return ' ';
+    const char symbol = SYMBOLS[static_cast<int>(getType())];
+    return getColor() == Color::White ? symbol : static_cast<char>(symbol - 'A' + 'a');
+}
+
 bool Piece::isValidMove(const Position& target, const Board* board) const {
     if (!board || !target.isValid()) {
         return false;
@@ -87,7 +135,7 @@ std::vector<Position> Piece::getStraightMoves(const Board* board) const {
             if (!square) break;
 
             if (square->isOccupied()) {
-                if (square->getPiece()->getColor() != color) {
+                if (square->getPiece()->getColor() != getColor()) {
                     moves.push_back(current);
                 }
                 break;
@@ -116,7 +164,7 @@ std::vector<Position> Piece::getDiagonalMoves(const Board* board) const {
             if (!square) break;
 
             if (square->isOccupied()) {
-                if (square->getPiece()->getColor() != color) {
+                if (square->getPiece()->getColor() != getColor()) {
                     moves.push_back(current);
                 }
                 break;
@@ -158,16 +206,16 @@ bool Piece::isSquareAccessible(const Position& target, const Board* board) const
     const Square* square = board->getSquare(target);
     if (!square) return false;
 
-    return !square->isOccupied() || square->getPiece()->getColor() != color;
+    return !square->isOccupied() || square->getPiece()->getColor() != getColor();
 }
 
 std::string Piece::toString() const {
     std::string result;
     result += "Piece(";
-    result += color == Color::White ? "White" : "Black";
+    result += getColor() == Color::White ? "White" : "Black";
     result += " ";
     
-    switch (type) {
+    switch (getType()) {
         case Type::Pawn:   result += "Pawn";   break;
         case Type::Knight: result += "Knight"; break;
         case Type::Bishop: result += "Bishop"; break;
@@ -193,7 +241,7 @@ Piece::PinInfo Piece::checkIfPinned(const Board* board) const {
             const Square* square = board->getSquare(x, y);
             if (square->isOccupied() && 
                 square->getPiece()->getType() == Type::King &&
-                square->getPiece()->getColor() == color) {
+                square->getPiece()->getColor() == getColor()) {
                 kingPos = Position(x, y);
                 kingFound = true;
             }
@@ -227,8 +275,8 @@ Piece::PinInfo Piece::checkIfPinned(const Board* board) const {
     while (board->isPositionValid(current)) {
         const Square* square = board->getSquare(current);
         if (square->isOccupied()) {
-            Piece* piece = square->getPiece();
-            if (piece->getColor() != color) {
+            const Piece* piece = square->getPiece();
+            if (piece->getColor() != getColor()) {
                 bool canPin = false;
                 if (dx == 0 || dy == 0) {
                     canPin = (piece->getType() == Type::Rook || 
@@ -1,19 +1,22 @@
 #pragma once
 #include "Position.hpp"
+#include <cstdint>
 #include <vector>
 #include <memory>
 
 class Board;
 class Square;
 
+// Value type stored inline in Square: colour and type are packed into one Code
+// byte, per-type behaviour is dispatched on getType() to the stateless facades.
 class Piece {
 public:
-    enum class Color {
+    enum class Color : std::uint8_t {
         White,
         Black
     };
 
-    enum class Type {
+    enum class Type : std::uint8_t {
         Pawn,
         Knight,
         Bishop,
@@ -21,24 +24,46 @@ public:
         Queen,
         King
     };
+
+    enum class Code : std::uint8_t {
+        None = 0,
+        WhitePawn = 1,
+        WhiteKnight,
+        WhiteBishop,
+        WhiteRook,
+        WhiteQueen,
+        WhiteKing,
+        BlackPawn = 9,
+        BlackKnight,
+        BlackBishop,
+        BlackRook,
+        BlackQueen,
+        BlackKing
+    };
+
+    Piece();
     Piece(Color color, Type type);
     Piece(Color color, Type type, Position position);
-    virtual ~Piece() = default;
 
-    Color getColor() const { return color; }
-    Type getType() const { return type; }
+    static Code makeCode(Color color, Type type) {
+        return static_cast<Code>((color == Color::Black ? 8 : 0) | (static_cast<int>(type) + 1));
+    }
+
+    Code getCode() const { return code; }
+    bool isNone() const { return code == Code::None; }
+    Color getColor() const { return (static_cast<int>(code) & 8) ? Color::Black : Color::White; }
+    Type getType() const { return static_cast<Type>((static_cast<int>(code) & 7) - 1); }
     Position getPosition() const { return position; }
     bool hasMoved() const { return moved; }
-    int getValue() const { return value; }
+    int getValue() const;
 
     void setPosition(const Position& newPosition);
     void setMoved(bool hasMoved) { moved = hasMoved; }
 
-    virtual std::vector<Position> getPossibleMoves(const Board* board) const = 0;
-    virtual std::vector<Position> getAttackedSquares(const Board* board) const = 0;
-    virtual bool canMoveTo(const Position& target, const Board* board) const = 0;
-    virtual char getSymbol() const = 0;
-    virtual Piece* clone() const = 0;
+    std::vector<Position> getPossibleMoves(const Board* board) const;
+    std::vector<Position> getAttackedSquares(const Board* board) const;
+    bool canMoveTo(const Position& target, const Board* board) const;
+    char getSymbol() const;
 
     bool isValidMove(const Position& target, const Board* board) const;
     bool threatens(const Position& target, const Board* board) const;
@@ -50,19 +75,18 @@ protected:
     bool isPathClear(const Position& target, const Board* board) const;
     bool isSquareAccessible(const Position& target, const Board* board) const;
 
-    Color color;
-    Type type;
     Position position;
+    Code code;
     bool moved;
-    int value;
+
     struct PinInfo {
         bool isPinned;
-        Position pinDirection; 
-        
+        Position pinDirection;
+
         PinInfo() : isPinned(false), pinDirection(0, 0) {}
-        PinInfo(bool pinned, const Position& dir) 
+        PinInfo(bool pinned, const Position& dir)
             : isPinned(pinned), pinDirection(dir) {}
     };
-    
+
     PinInfo checkIfPinned(const Board* board) const;
-};
\ No newline at end of file
+};
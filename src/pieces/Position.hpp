@@ -11,6 +11,9 @@ public:
     void setX(int x) { this->x = x;}
     void setY(int y) { this->y = y;}
     
+    int toIndex() const { return y * 8 + x; }
+    static Position fromIndex(int index) { return Position(index % 8, index / 8); }
+
     bool isValid() const;  
     std::string toAlgebraic() const;  
     bool operator==(const Position& other) const;
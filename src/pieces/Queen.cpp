@@ -8,6 +8,10 @@ Queen::Queen(Color color, Position position)
     : Piece(color, Type::Queen, position) {
 }
 
+Queen::Queen(const Piece& piece)
+    : Piece(piece) {
+}
+
 std::vector<Position> Queen::getPossibleMoves(const Board* board) const {
     std::vector<Position> moves;
     if (!board) return moves;
@@ -15,10 +19,11 @@ std::vector<Position> Queen::getPossibleMoves(const Board* board) const {
     auto straightMoves = getStraightMoves(board);
     auto diagonalMoves = getDiagonalMoves(board);
     
-    auto checkMove = [board, this](const Position& move) {
-        Board tempBoard(*board);
+    Board tempBoard(*board);
+    auto checkMove = [board, this, &tempBoard](const Position& move) {
+        tempBoard = *board;
         tempBoard.movePiece(position, move);
-        return !tempBoard.isCheck(color);
+        return !tempBoard.isCheck(getColor());
     };
     
     for (const auto& move : straightMoves) {
@@ -55,15 +60,7 @@ bool Queen::canMoveTo(const Position& target, const Board* board) const {
 
     const Square* targetSquare = board->getSquare(target);
     return !targetSquare->isOccupied() || 
-           targetSquare->getPiece()->getColor() != color;
-}
-
-char Queen::getSymbol() const {
-    return color == Color::White ? 'Q' : 'q';
-}
-
-Piece* Queen::clone() const {
-    return new Queen(*this);
+           targetSquare->getPiece()->getColor() != getColor();
 }
 
 bool Queen::isValidQueenMove(const Position& target) const {
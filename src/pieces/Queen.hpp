@@ -6,12 +6,11 @@ class Queen : public Piece {
 public:
     Queen(Color color);
     Queen(Color color, Position position);
+    explicit Queen(const Piece& piece);
     
-    std::vector<Position> getPossibleMoves(const Board* board) const override;
-    std::vector<Position> getAttackedSquares(const Board* board) const override;
-    bool canMoveTo(const Position& target, const Board* board) const override;
-    char getSymbol() const override;
-    Piece* clone() const override;
+    std::vector<Position> getPossibleMoves(const Board* board) const;
+    std::vector<Position> getAttackedSquares(const Board* board) const;
+    bool canMoveTo(const Position& target, const Board* board) const;
 
 private:
     bool isValidQueenMove(const Position& target) const;
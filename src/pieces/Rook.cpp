@@ -8,6 +8,10 @@ Rook::Rook(Color color, Position position)
     : Piece(color, Type::Rook, position) {
 }
 
+Rook::Rook(const Piece& piece)
+    : Piece(piece) {
+}
+
 std::vector<Position> Rook::getPossibleMoves(const Board* board) const {
     std::vector<Position> moves;
     if (!board) return moves;
@@ -28,7 +32,7 @@ std::vector<Position> Rook::getPossibleMoves(const Board* board) const {
             if (!targetSquare->isOccupied()) {
                 moves.push_back(current);
             } else {
-                if (targetSquare->getPiece()->getColor() != color) {
+                if (targetSquare->getPiece()->getColor() != getColor()) {
                     moves.push_back(current);
                 }
                 break;
@@ -44,7 +48,7 @@ std::vector<Position> Rook::getPossibleMoves(const Board* board) const {
             if (!targetSquare->isOccupied()) {
                 moves.push_back(current);
             } else {
-                if (targetSquare->getPiece()->getColor() != color) {
+                if (targetSquare->getPiece()->getColor() != getColor()) {
                     moves.push_back(current);
                 }
                 break;
@@ -59,6 +63,7 @@ std::vector<Position> Rook::getPossibleMoves(const Board* board) const {
         {0, 1}, {0, -1}, {1, 0}, {-1, 0}  
     };
 
+    Board tempBoard(*board);
     for (const auto& move : directions) {
         Position current = position;
         while (true) {
@@ -67,16 +72,16 @@ std::vector<Position> Rook::getPossibleMoves(const Board* board) const {
             
             const Square* targetSquare = board->getSquare(current);
             if (!targetSquare->isOccupied()) {
-                Board tempBoard(*board);
+                tempBoard = *board;
                 tempBoard.movePiece(position, current);
-                if (!tempBoard.isCheck(color)) {
+                if (!tempBoard.isCheck(getColor())) {
                     moves.push_back(current);
                 }
             } else {
-                if (targetSquare->getPiece()->getColor() != color) {
-                    Board tempBoard(*board);
+                if (targetSquare->getPiece()->getColor() != getColor()) {
+                    tempBoard = *board;
                     tempBoard.movePiece(position, current);
-                    if (!tempBoard.isCheck(color)) {
+                    if (!tempBoard.isCheck(getColor())) {
                         moves.push_back(current);
                     }
                 }
@@ -107,15 +112,7 @@ bool Rook::canMoveTo(const Position& target, const Board* board) const {
 
     const Square* targetSquare = board->getSquare(target);
     return !targetSquare->isOccupied() || 
-           targetSquare->getPiece()->getColor() != color;
-}
-
-char Rook::getSymbol() const {
-    return color == Color::White ? 'R' : 'r';
-}
-
-Piece* Rook::clone() const {
-    return new Rook(*this);
+           targetSquare->getPiece()->getColor() != getColor();
 }
 
 bool Rook::isValidRookMove(const Position& target) const {
@@ -0,0 +1,345 @@
+#include "UciEngine.hpp"
+#include "analysis/Bench.hpp"
+#include "board/Fen.hpp"
+#include "moves/MoveGenerator.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+const char* const START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+Piece::Color opposite(Piece::Color color) {
+    return color == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
+}
+
+// Only real mates are reported as "mate"; a tablebase win is a large cp score.
+std::string formatScore(int score) {
+    if (AI::isMateScore(score)) {
+        return "mate " + std::to_string(AI::mateInMoves(score));
+    }
+    return "cp " + std::to_string(AI::toCentipawns(score));
+}
+}
+
+UciEngine::UciEngine(std::istream& input, std::ostream& output)
+    : input(input)
+    , output(output)
+    , sideToMove(Piece::Color::White)
+    , depth(DEFAULT_DEPTH)
+    , stopRequested(false)
+    , searching(false)
+    , pondering(false)
+    , infinite(false)
+    , timeBudget(0) {
+    setupPosition(START_FEN);
+    ai.setStopFlag(&stopRequested);
+    ai.setIterationCallback([this](const AI::SearchResult& result) { sendInfo(result); });
+}
+
+UciEngine::~UciEngine() {
+    handleStop();
+}
+
+void UciEngine::run() {
+    std::string line;
+    while (std::getline(input, line)) {
+        if (!handleCommand(line)) {
+            break;
+        }
+    }
+    handleStop();
+}
+
+bool UciEngine::handleCommand(const std::string& line) {
+    std::istringstream stream(line);
+    std::string command;
+    if (!(stream >> command)) {
+        return true;
+    }
+
+    if (command == "uci") {
+        handleUci();
+    } else if (command == "isready") {
+        send("readyok");
+    } else if (command == "ucinewgame") {
+        handleStop();
+        setupPosition(START_FEN);
+    } else if (command == "position") {
+        handlePosition(stream);
+    } else if (command == "go") {
+        handleGo(stream);
+    } else if (command == "stop") {
+        handleStop();
+    } else if (command == "ponderhit") {
+        handlePonderHit();
+    } else if (command == "setoption") {
+        handleSetOption(stream);
+    } else if (command == "bench") {
+        handleBench(stream);
+    } else if (command == "quit") {
+        handleStop();
+        return false;
+    } else {
+        send("info string unknown command " + command);
+    }
+    return true;
+}
+
+void UciEngine::handleUci() {
+    send("id name Chess");
+    send("id author irox-0");
+    send("option name Depth type spin default " + std::to_string(DEFAULT_DEPTH) +
+         " min 1 max " + std::to_string(MAX_DEPTH));
+    send("option name Ponder type check default false");
+    send("option name BookFile type string default <empty>");
+    send("option name MultiPV type spin default 1 min 1 max " + std::to_string(MAX_MULTI_PV));
+    send("uciok");
+}
+
+void UciEngine::handlePosition(std::istringstream& stream) {
+    handleStop();
+
+    std::string token;
+    stream >> token;
+
+    std::string fen;
+    if (token == "startpos") {
+        fen = START_FEN;
+        stream >> token;
+    } else if (token == "fen") {
+        while (stream >> token && token != "moves") {
+            fen += (fen.empty() ? "" : " ") + token;
+        }
+    } else {
+        send("info string invalid position command");
+        return;
+    }
+
+    if (!setupPosition(fen)) {
+        return;
+    }
+
+    if (token != "moves") {
+        return;
+    }
+
+    while (stream >> token) {
+        Move move;
+        if (!parseMove(token, move) || !board.applyMove(move)) {
+            send("info string illegal move " + token);
+            return;
+        }
+        sideToMove = opposite(sideToMove);
+    }
+}
+
+void UciEngine::handleGo(std::istringstream& stream) {
+    handleStop();
+
+    SearchLimits limits;
+    std::string token;
+    while (stream >> token) {
+        if (token == "depth") stream >> limits.depth;
+        else if (token == "movetime") stream >> limits.moveTime;
+        else if (token == "wtime") stream >> limits.whiteTime;
+        else if (token == "btime") stream >> limits.blackTime;
+        else if (token == "winc") stream >> limits.whiteIncrement;
+        else if (token == "binc") stream >> limits.blackIncrement;
+        else if (token == "movestogo") stream >> limits.movesToGo;
+        else if (token == "infinite") limits.infinite = true;
+        else if (token == "ponder") limits.ponder = true;
+    }
+
+    startSearch(limits);
+}
+
+void UciEngine::handleStop() {
+    {
+        std::lock_guard<std::mutex> lock(searchMutex);
+        stopRequested = true;
+    }
+    searchSignal.notify_all();
+    waitForSearch();
+}
+
+void UciEngine::handlePonderHit() {
+    {
+        std::lock_guard<std::mutex> lock(searchMutex);
+        if (!pondering) {
+            return;
+        }
+        pondering = false;
+        if (timeBudget.count() > 0) {
+            deadline = std::chrono::steady_clock::now() + timeBudget;
+        }
+    }
+    searchSignal.notify_all();
+}
+
+void UciEngine::handleSetOption(std::istringstream& stream) {
+    std::string token;
+    std::string name;
+    std::string value;
+    stream >> token;
+    while (stream >> token && token != "value") {
+        name += (name.empty() ? "" : " ") + token;
+    }
+    std::getline(stream >> std::ws, value);
+
+    if (name == "Depth") {
+        try {
+            depth = std::max(1, std::min(MAX_DEPTH, std::stoi(value)));
+        } catch (const std::exception&) {
+            send("info string invalid value for Depth");
+        }
+    } else if (name == "MultiPV") {
+        handleStop();
+        try {
+            ai.setMultiPv(std::max(1, std::min(MAX_MULTI_PV, std::stoi(value))));
+        } catch (const std::exception&) {
+            send("info string invalid value for MultiPV");
+        }
+    } else if (name == "BookFile") {
+        handleStop();
+        if (value.empty() || value == "<empty>") {
+            book.close();
+        } else if (!book.open(value)) {
+            send("info string could not open book " + value);
+        }
+        ai.setOpeningBook(book.isOpen() ? &book : nullptr);
+    } else if (name != "Ponder") {
+        send("info string unknown option " + name);
+    }
+}
+
+void UciEngine::handleBench(std::istringstream& stream) {
+    handleStop();
+
+    int benchDepth = Bench::DEFAULT_DEPTH;
+    stream >> benchDepth;
+    std::lock_guard<std::mutex> lock(outputMutex);
+    Bench::run(output, std::max(1, std::min(MAX_DEPTH, benchDepth)));
+}
+
+bool UciEngine::setupPosition(const std::string& fen) {
+    Fen::State state;
+    const Fen::Error error = Fen::parse(fen, board, state);
+    if (error != Fen::Error::None) {
+        send(std::string("info string invalid fen: ") + Fen::errorMessage(error));
+        return false;
+    }
+    sideToMove = state.sideToMove;
+    return true;
+}
+
+bool UciEngine::parseMove(const std::string& text, Move& move) const {
+    if (text.size() < 4 || text.size() > 5) {
+        return false;
+    }
+
+    const Position from(text.substr(0, 2));
+    const Position to(text.substr(2, 2));
+    for (const Move& candidate : MoveGenerator::generateAllMoves(&board, sideToMove)) {
+        if (candidate.getFrom() == from && candidate.getTo() == to &&
+            candidate.toAlgebraic() == text) {
+            move = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::chrono::milliseconds UciEngine::allocateTime(const SearchLimits& limits) const {
+    if (limits.moveTime > 0) {
+        return std::chrono::milliseconds(limits.moveTime);
+    }
+
+    const bool white = sideToMove == Piece::Color::White;
+    const int remaining = white ? limits.whiteTime : limits.blackTime;
+    const int increment = white ? limits.whiteIncrement : limits.blackIncrement;
+    if (remaining <= 0) {
+        return std::chrono::milliseconds(0);
+    }
+
+    const int movesLeft = limits.movesToGo > 0 ? limits.movesToGo : 30;
+    const int budget = remaining / movesLeft + increment / 2;
+    return std::chrono::milliseconds(std::max(10, std::min(budget, remaining - 50)));
+}
+
+void UciEngine::startSearch(const SearchLimits& limits) {
+    timeBudget = allocateTime(limits);
+    const bool timed = timeBudget.count() > 0;
+
+    if (limits.depth > 0) {
+        ai.setDepth(limits.depth);
+    } else {
+        ai.setDepth(timed || limits.infinite ? MAX_DEPTH : depth);
+    }
+
+    stopRequested = false;
+    searching = true;
+    pondering = limits.ponder;
+    infinite = limits.infinite;
+    deadline = timed ? std::chrono::steady_clock::now() + timeBudget
+                     : std::chrono::steady_clock::time_point::max();
+
+    searchThread = std::thread(&UciEngine::search, this, board, sideToMove);
+    clockThread = std::thread(&UciEngine::watchClock, this);
+}
+
+void UciEngine::waitForSearch() {
+    if (searchThread.joinable()) {
+        searchThread.join();
+    }
+    if (clockThread.joinable()) {
+        clockThread.join();
+    }
+}
+
+void UciEngine::search(Board position, Piece::Color color) {
+    const Move bestMove = ai.getMove(&position, color);
+
+    std::unique_lock<std::mutex> lock(searchMutex);
+    searching = false;
+    searchSignal.notify_all();
+    // UCI forbids reporting a ponder or infinite search before stop/ponderhit.
+    searchSignal.wait(lock, [this] { return stopRequested || (!pondering && !infinite); });
+    lock.unlock();
+
+    send(bestMove.getFrom().isValid() ? "bestmove " + bestMove.toAlgebraic() : "bestmove 0000");
+}
+
+void UciEngine::watchClock() {
+    std::unique_lock<std::mutex> lock(searchMutex);
+    while (searching && !stopRequested) {
+        if (pondering || deadline == std::chrono::steady_clock::time_point::max()) {
+            searchSignal.wait(lock);
+        } else if (searchSignal.wait_until(lock, deadline) == std::cv_status::timeout) {
+            stopRequested = true;
+            searchSignal.notify_all();
+        }
+    }
+}
+
+void UciEngine::sendInfo(const AI::SearchResult& result) {
+    for (std::size_t i = 0; i < result.lines.size(); ++i) {
+        const AI::PvLine& line = result.lines[i];
+        std::ostringstream info;
+        info << "info depth " << result.depth << " seldepth " << result.stats.selectiveDepth;
+        if (ai.getMultiPv() > 1) {
+            info << " multipv " << i + 1;
+        }
+        info << " score " << formatScore(line.score) << " nodes " << result.stats.nodes
+             << " nps " << result.stats.nodesPerSecond() << " time " << result.stats.elapsedMs()
+             << " pv";
+        for (const Move& move : line.pv) {
+            info << ' ' << move.toAlgebraic();
+        }
+        send(info.str());
+    }
+}
+
+void UciEngine::send(const std::string& line) {
+    std::lock_guard<std::mutex> lock(outputMutex);
+    output << line << std::endl;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "board/Board.hpp"
+#include "moves/Move.hpp"
+#include "ai/AI.hpp"
+#include "ai/OpeningBook.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iosfwd>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+// UCI front-end: commands are read on the caller's thread, the search runs on
+// its own thread so "stop" and "ponderhit" are handled while it is thinking.
+class UciEngine {
+public:
+    UciEngine(std::istream& input, std::ostream& output);
+    ~UciEngine();
+
+    void run();
+    // Returns false once "quit" has been received.
+    bool handleCommand(const std::string& line);
+    // Blocks until the current search has reported its bestmove.
+    void waitForSearch();
+
+    const Board& getBoard() const { return board; }
+    Piece::Color getSideToMove() const { return sideToMove; }
+
+private:
+    struct SearchLimits {
+        int depth = 0;
+        int moveTime = 0;
+        int whiteTime = 0;
+        int blackTime = 0;
+        int whiteIncrement = 0;
+        int blackIncrement = 0;
+        int movesToGo = 0;
+        bool infinite = false;
+        bool ponder = false;
+    };
+
+    static constexpr int DEFAULT_DEPTH = 3;
+    static constexpr int MAX_DEPTH = 64;
+    static constexpr int MAX_MULTI_PV = 16;
+
+    std::istream& input;
+    std::ostream& output;
+    std::mutex outputMutex;
+
+    Board board;
+    Piece::Color sideToMove;
+    AI ai;
+    OpeningBook book;
+    int depth;
+
+    std::thread searchThread;
+    std::thread clockThread;
+    std::atomic<bool> stopRequested;
+    std::mutex searchMutex;
+    std::condition_variable searchSignal;
+    bool searching;
+    bool pondering;
+    bool infinite;
+    std::chrono::milliseconds timeBudget;
+    std::chrono::steady_clock::time_point deadline;
+
+    void handleUci();
+    void handlePosition(std::istringstream& stream);
+    void handleGo(std::istringstream& stream);
+    void handleStop();
+    void handlePonderHit();
+    void handleSetOption(std::istringstream& stream);
+    void handleBench(std::istringstream& stream);
+
+    bool setupPosition(const std::string& fen);
+    bool parseMove(const std::string& text, Move& move) const;
+    std::chrono::milliseconds allocateTime(const SearchLimits& limits) const;
+
+    void startSearch(const SearchLimits& limits);
+    void search(Board position, Piece::Color color);
+    void watchClock();
+    void sendInfo(const AI::SearchResult& result);
+    void send(const std::string& line);
+};
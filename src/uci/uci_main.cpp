@@ -0,0 +1,24 @@
+#include "uci/UciEngine.hpp"
+#include "analysis/Bench.hpp"
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "bench") {
+        int depth = Bench::DEFAULT_DEPTH;
+        if (argc > 2) {
+            try {
+                depth = std::stoi(argv[2]);
+            } catch (const std::exception&) {
+                std::cerr << "Usage: chess_uci [bench [depth]]\n";
+                return 1;
+            }
+        }
+        Bench::run(std::cout, depth);
+        return 0;
+    }
+
+    UciEngine engine(std::cin, std::cout);
+    engine.run();
+    return 0;
+}
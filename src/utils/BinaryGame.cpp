@@ -0,0 +1,231 @@
+#include "BinaryGame.hpp"
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+namespace {
+const char DATA_MAGIC[4] = {'C', 'H', 'G', 'B'};
+const char INDEX_MAGIC[4] = {'C', 'H', 'G', 'I'};
+
+void writeInt(std::ostream& out, std::uint64_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+        out.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+bool readInt(std::istream& in, std::uint64_t& value, int bytes) {
+    unsigned char buffer[8];
+    if (!in.read(reinterpret_cast<char*>(buffer), bytes)) {
+        return false;
+    }
+    value = 0;
+    for (int i = 0; i < bytes; ++i) {
+        value |= static_cast<std::uint64_t>(buffer[i]) << (8 * i);
+    }
+    return true;
+}
+
+bool readString(std::istream& in, std::string& text, int lengthBytes) {
+    std::uint64_t length;
+    if (!readInt(in, length, lengthBytes)) {
+        return false;
+    }
+    text.resize(length);
+    return length == 0 || static_cast<bool>(in.read(&text[0], length));
+}
+
+bool checkMagic(std::istream& in, const char (&magic)[4]) {
+    char buffer[4];
+    return in.read(buffer, 4) && std::equal(buffer, buffer + 4, magic);
+}
+
+Piece::Color opposite(Piece::Color color) {
+    return color == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
+}
+}
+
+std::uint16_t BinaryGame::encodeMove(const Move& move) {
+    int promotion = 0;
+    if (move.getType() == Move::Type::Promotion) {
+        promotion = static_cast<int>(move.getPromotionPiece());
+    }
+    return static_cast<std::uint16_t>(move.getFrom().toIndex() |
+                                      (move.getTo().toIndex() << 6) |
+                                      (promotion << 12));
+}
+
+Move BinaryGame::decodeMove(std::uint16_t code) {
+    const Position from = Position::fromIndex(code & 0x3F);
+    const Position to = Position::fromIndex((code >> 6) & 0x3F);
+    const int promotion = (code >> 12) & 0x7;
+    if (promotion == 0) {
+        return Move(from, to);
+    }
+    return Move(from, to, Move::Type::Promotion, static_cast<Piece::Type>(promotion));
+}
+
+std::uint8_t BinaryGame::encodeResult(const std::string& result) {
+    if (result == "1-0") return 1;
+    if (result == "0-1") return 2;
+    if (result == "1/2-1/2") return 3;
+    return 0;
+}
+
+std::string BinaryGame::decodeResult(std::uint8_t code) {
+    switch (code) {
+        case 1:  return "1-0";
+        case 2:  return "0-1";
+        case 3:  return "1/2-1/2";
+        default: return "*";
+    }
+}
+
+BinaryGameWriter::BinaryGameWriter(const std::string& path)
+    : indexPath(path + ".idx")
+    , data(path, std::ios::binary) {
+    if (data.is_open()) {
+        data.write(DATA_MAGIC, 4);
+    }
+}
+
+BinaryGameWriter::~BinaryGameWriter() {
+    close();
+}
+
+bool BinaryGameWriter::writeGame(const PgnGame& game) {
+    if (!data.is_open() || game.moves.size() > 0xFFFF || game.tags.size() > 0xFF) {
+        return false;
+    }
+
+    offsets.push_back(static_cast<std::uint64_t>(data.tellp()));
+    writeInt(data, game.moves.size(), 2);
+    writeInt(data, BinaryGame::encodeResult(game.result), 1);
+    writeInt(data, game.tags.size(), 1);
+    for (const auto& tag : game.tags) {
+        const std::size_t nameLength = std::min<std::size_t>(tag.first.size(), 0xFF);
+        const std::size_t valueLength = std::min<std::size_t>(tag.second.size(), 0xFFFF);
+        writeInt(data, nameLength, 1);
+        data.write(tag.first.data(), nameLength);
+        writeInt(data, valueLength, 2);
+        data.write(tag.second.data(), valueLength);
+    }
+    for (const Move& move : game.moves) {
+        writeInt(data, BinaryGame::encodeMove(move), 2);
+    }
+    return static_cast<bool>(data);
+}
+
+bool BinaryGameWriter::close() {
+    if (!data.is_open()) {
+        return false;
+    }
+    data.close();
+
+    std::ofstream index(indexPath, std::ios::binary);
+    if (!index.is_open()) {
+        std::cerr << "Error opening file for writing: " << indexPath << std::endl;
+        return false;
+    }
+    index.write(INDEX_MAGIC, 4);
+    writeInt(index, offsets.size(), 8);
+    for (std::uint64_t offset : offsets) {
+        writeInt(index, offset, 8);
+    }
+    return static_cast<bool>(index);
+}
+
+BinaryGameReader::BinaryGameReader(const std::string& path)
+    : open(false)
+    , data(path, std::ios::binary) {
+    std::ifstream index(path + ".idx", std::ios::binary);
+    std::uint64_t count;
+    if (!data.is_open() || !checkMagic(data, DATA_MAGIC) ||
+        !index.is_open() || !checkMagic(index, INDEX_MAGIC) || !readInt(index, count, 8)) {
+        return;
+    }
+
+    // The count comes from the file; only trust it as far as the file has entries for it.
+    const std::streamoff entriesStart = index.tellg();
+    index.seekg(0, std::ios::end);
+    const std::streamoff entryBytes = index.tellg() - entriesStart;
+    index.seekg(entriesStart);
+    if (entriesStart < 0 || entryBytes < 0 || count > static_cast<std::uint64_t>(entryBytes) / 8) {
+        return;
+    }
+
+    offsets.resize(count);
+    for (std::uint64_t& offset : offsets) {
+        if (!readInt(index, offset, 8)) {
+            offsets.clear();
+            return;
+        }
+    }
+    open = true;
+}
+
+bool BinaryGameReader::readHeader(std::size_t index, PgnGame& game, std::uint16_t& moveCount) {
+    if (!open || index >= offsets.size()) {
+        return false;
+    }
+
+    data.clear();
+    data.seekg(offsets[index]);
+
+    std::uint64_t count, result, tagCount;
+    if (!readInt(data, count, 2) || !readInt(data, result, 1) || !readInt(data, tagCount, 1)) {
+        return false;
+    }
+
+    game = PgnGame();
+    game.result = BinaryGame::decodeResult(static_cast<std::uint8_t>(result));
+    for (std::uint64_t i = 0; i < tagCount; ++i) {
+        std::string name, value;
+        if (!readString(data, name, 1) || !readString(data, value, 2)) {
+            return false;
+        }
+        game.tags.emplace_back(name, value);
+    }
+    moveCount = static_cast<std::uint16_t>(count);
+    return true;
+}
+
+bool BinaryGameReader::readGame(std::size_t index, PgnGame& game) {
+    std::uint16_t moveCount;
+    if (!readHeader(index, game, moveCount)) {
+        return false;
+    }
+
+    std::vector<unsigned char> buffer(moveCount * 2u);
+    if (moveCount && !data.read(reinterpret_cast<char*>(buffer.data()), buffer.size())) {
+        return false;
+    }
+    game.moves.reserve(moveCount);
+    for (std::size_t i = 0; i < moveCount; ++i) {
+        game.moves.push_back(BinaryGame::decodeMove(buffer[2 * i] | (buffer[2 * i + 1] << 8)));
+    }
+    return true;
+}
+
+bool BinaryGameReader::readMoves(std::size_t index, std::vector<Move>& moves) {
+    PgnGame game;
+    if (!readGame(index, game)) {
+        return false;
+    }
+    moves = std::move(game.moves);
+    return true;
+}
+
+bool BinaryGameReader::positionAt(std::size_t index, std::size_t ply, Board& board, Piece::Color& sideToMove) {
+    PgnGame game;
+    if (!readGame(index, game) || ply > game.moves.size() || !game.startPosition(board, sideToMove)) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < ply; ++i) {
+        if (!board.applyMove(game.moves[i])) {
+            return false;
+        }
+        sideToMove = opposite(sideToMove);
+    }
+    return true;
+}
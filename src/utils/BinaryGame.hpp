@@ -0,0 +1,57 @@
+#pragma once
+#include "utils/Pgn.hpp"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Compact game archive. The data file holds a magic header followed by one
+// record per game:
+//   u16 move count, u8 result, u8 tag count,
+//   per tag: u8 name length, name, u16 value length, value,
+//   u16 per move: from square | to square << 6 | promotion << 12.
+// "<data>.idx" holds a magic header, a u64 game count and one u64 record offset
+// per game, so any game is a single seek away. All integers are little-endian.
+class BinaryGame {
+public:
+    static std::uint16_t encodeMove(const Move& move);
+    static Move decodeMove(std::uint16_t code);
+    static std::uint8_t encodeResult(const std::string& result);
+    static std::string decodeResult(std::uint8_t code);
+};
+
+class BinaryGameWriter {
+public:
+    explicit BinaryGameWriter(const std::string& path);
+    ~BinaryGameWriter();
+
+    bool isOpen() const { return data.is_open(); }
+    bool writeGame(const PgnGame& game);
+    // Writes the index; called by the destructor if not called explicitly.
+    bool close();
+
+private:
+    std::string indexPath;
+    std::ofstream data;
+    std::vector<std::uint64_t> offsets;
+};
+
+class BinaryGameReader {
+public:
+    explicit BinaryGameReader(const std::string& path);
+
+    bool isOpen() const { return open; }
+    std::size_t getGameCount() const { return offsets.size(); }
+
+    bool readGame(std::size_t index, PgnGame& game);
+    bool readMoves(std::size_t index, std::vector<Move>& moves);
+    // Position after `ply` moves of the game.
+    bool positionAt(std::size_t index, std::size_t ply, Board& board, Piece::Color& sideToMove);
+
+private:
+    bool open;
+    std::ifstream data;
+    std::vector<std::uint64_t> offsets;
+
+    bool readHeader(std::size_t index, PgnGame& game, std::uint16_t& moveCount);
+};
@@ -1,66 +1,40 @@
 #include "GameLogger.hpp"
+#include <ctime>
 #include <sstream>
 #include <iostream>
 
 GameLogger::GameLogger(Game* game) : game(game) {}
 
-char GameLogger::getPieceNotation(Piece::Type type) const {
-    switch (type) {
-        case Piece::Type::King:   return 'K';
-        case Piece::Type::Queen:  return 'Q';
-        case Piece::Type::Rook:   return 'R';
-        case Piece::Type::Bishop: return 'B';
-        case Piece::Type::Knight: return 'N';
-        case Piece::Type::Pawn:   return 'P';
-        default:                  return '?';
-    }
-}
 const std::string GameLogger::SAVE_DIRECTORY = "../resources/saved_games/";
 
-
-std::string GameLogger::moveToNotation(const std::string& from, const std::string& to,
-                                     Piece::Type pieceType, Piece::Color pieceColor,
-                                     bool isCapture, bool isCheck,
-                                     bool isCheckmate, Piece::Type promotionPiece) {
-    std::string notation;
-    
-    if (pieceType != Piece::Type::Pawn) {
-        notation += getPieceNotation(pieceType);
+std::string GameLogger::resultToString() const {
+    switch (game->getResult()) {
+        case GameState::Result::WhiteWin:  return "1-0";
+        case GameState::Result::BlackWin:  return "0-1";
+        case GameState::Result::Draw:
+        case GameState::Result::Stalemate: return "1/2-1/2";
+        default:                           return "*";
     }
-    
-    notation += from;
-    
-    if (isCapture) {
-        notation += "x";
-    } else {
-        notation += "-";
-    }
-    
-    notation += to;
-    
-    if (pieceType == Piece::Type::Pawn && 
-        (to[1] == '8' || to[1] == '1')) {
-        notation += "=";
-        notation += getPieceNotation(promotionPiece);
-    }
-    
-    if (isCheckmate) {
-        notation += "#";
-    } else if (isCheck) {
-        notation += "+";
-    }
-    
-    return notation;
 }
 
-void GameLogger::logMove(const std::string& from, const std::string& to,
-                        Piece::Type pieceType, Piece::Color pieceColor,
-                        bool isCapture, bool isCheck,
-                        bool isCheckmate, Piece::Type promotionPiece) {
-    std::string notation = moveToNotation(from, to, pieceType, pieceColor,
-                                        isCapture, isCheck, isCheckmate,
-                                        promotionPiece);
-    moveHistory.push_back(notation);
+PgnGame GameLogger::toPgn() const {
+    PgnGame pgn;
+    char date[11] = "????.??.??";
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y.%m.%d", std::localtime(&now));
+
+    pgn.setTag("Event", "Casual Game");
+    pgn.setTag("Site", "?");
+    pgn.setTag("Date", date);
+    pgn.setTag("Round", "-");
+    pgn.setTag("White", "?");
+    pgn.setTag("Black", "?");
+    if (game) {
+        pgn.result = resultToString();
+        pgn.moves = game->getGameState()->getMoveHistory();
+    }
+    pgn.setTag("Result", pgn.result);
+    return pgn;
 }
 
 bool GameLogger::saveGame(const std::string& filename) {
@@ -84,83 +58,11 @@ bool GameLogger::saveGame(const std::string& filename) {
     if (!file.is_open()) {
         return false;
     }
-    
-    for (size_t i = 0; i < moveHistory.size(); ++i) {
-        if (i % 2 == 0) {
-            file << (i / 2 + 1) << ". ";
-        }
-        file << moveHistory[i] << " ";
-        if (i % 2 == 1) {
-            file << "\n";
-        }
-    }
-    
-    if (moveHistory.size() % 2 == 1) {
-        file << "\n";
-    }
-    
-    return true;
-}
-
 
-bool GameLogger::parseNotation(const std::string& notation, std::string& from, 
-                             std::string& to, Piece::Type& pieceType) {
-    //std::cout << "Parsing notation: " << notation << std::endl;
-    
-    if (notation.length() < 4) {
-        std::cerr << "Notation too short" << std::endl;
-        return false;
-    }
-    
-    size_t startPos = 0;
-    pieceType = Piece::Type::Pawn;
-    
-    if (std::isupper(notation[0])) {
-        //std::cout << "Found piece prefix: " << notation[0] << std::endl;
-        switch (notation[0]) {
-            case 'K': pieceType = Piece::Type::King; break;
-            case 'Q': pieceType = Piece::Type::Queen; break;
-            case 'R': pieceType = Piece::Type::Rook; break;
-            case 'B': pieceType = Piece::Type::Bishop; break;
-            case 'N': pieceType = Piece::Type::Knight; break;
-            default: 
-                std::cerr << "Invalid piece prefix" << std::endl;
-                return false;
-        }
-        startPos = 1;
-    }
-    
-    from = notation.substr(startPos, 2);
-    //std::cout << "Extracted 'from' position: " << from << std::endl;
-    
-    if (!isValidSquare(from)) {
-        std::cerr << "Invalid 'from' square: " << from << std::endl;
-        return false;
-    }
-    
-    size_t moveSymbol = notation.find('-');
-    if (moveSymbol == std::string::npos) {
-        moveSymbol = notation.find('x');
-        if (moveSymbol == std::string::npos) {
-            std::cerr << "No move symbol found" << std::endl;
-            return false;
-        }
-    }
-    
-    to = notation.substr(moveSymbol + 1, 2);
-    //std::cout << "Extracted 'to' position: " << to << std::endl;
-    
-    if (!isValidSquare(to)) {
-        std::cerr << "Invalid 'to' square: " << to << std::endl;
-        return false;
-    }
-    
-    //std::cout << "Successfully parsed move: " << from << " to " << to << std::endl;
-    return true;
+    PgnWriter writer(file);
+    return writer.writeGame(toPgn());
 }
 
-
-
 bool GameLogger::loadGame(const std::string& filename) {
     if (!game) {
         std::cerr << "Game pointer is null" << std::endl;
@@ -173,40 +75,32 @@ bool GameLogger::loadGame(const std::string& filename) {
         std::cerr << "Could not open file: " << fullPath << std::endl;
         return false;
     }
+
+    PgnReader reader(file);
+    PgnGame pgn;
+    if (!reader.readGame(pgn)) {
+        std::cerr << "No game found in: " << fullPath << std::endl;
+        return false;
+    }
+    if (!pgn.error.empty()) {
+        std::cerr << pgn.error << std::endl;
+        return false;
+    }
+    if (!pgn.getTag("FEN").empty()) {
+        std::cerr << "Games from a set-up position are not supported" << std::endl;
+        return false;
+    }
     
     game->reset();
     game->initialize();
-    
-    std::string line;
-    while (std::getline(file, line)) {
-        while (!line.empty() && std::isspace(line.back())) {
-            line.pop_back();
+
+    for (const Move& move : pgn.moves) {
+        std::string to = move.getTo().toAlgebraic();
+        if (move.getType() == Move::Type::Promotion) {
+            to += move.toAlgebraic().back();
         }
-        
-        if (line.empty()) continue;
-        
-        std::istringstream iss(line);
-        std::string token;
-        
-        if (!(iss >> token) || token.back() != '.') continue;
-        
-        std::string notation;
-        if (iss >> notation) {  
-            std::string from, to;
-            Piece::Type pieceType;
-            if (parseNotation(notation, from, to, pieceType)) {
-                if (!game->makeMove(from, to)) {
-                    return false;
-                }
-            }
-            
-            if (iss >> notation) {  
-                if (parseNotation(notation, from, to, pieceType)) {
-                    if (!game->makeMove(from, to)) {
-                        return false;
-                    }
-                }
-            }
+        if (!game->makeMove(move.getFrom().toAlgebraic(), to)) {
+            return false;
         }
     }
     
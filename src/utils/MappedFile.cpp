@@ -0,0 +1,50 @@
+#include "MappedFile.hpp"
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <iterator>
+#endif
+
+MappedFile::MappedFile(const std::string& path, Access access) {
+#ifndef _WIN32
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) == 0) {
+        valid = true;
+        if (info.st_size > 0) {
+            void* mapping = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                valid = false;
+            } else {
+                ::madvise(mapping, info.st_size,
+                          access == Access::Sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+                mappedData = static_cast<const char*>(mapping);
+                mappedSize = info.st_size;
+            }
+        }
+    }
+    ::close(fd);
+#else
+    (void)access;
+    std::ifstream file(path, std::ios::binary);
+    if (file) {
+        buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        valid = true;
+    }
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+    if (mappedData) {
+        ::munmap(const_cast<char*>(mappedData), mappedSize);
+    }
+#endif
+}
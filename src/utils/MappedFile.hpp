@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+// Read-only view of a whole file: mmap on POSIX, a heap copy elsewhere.
+class MappedFile {
+public:
+    enum class Access {
+        Sequential,
+        Random
+    };
+
+    explicit MappedFile(const std::string& path, Access access = Access::Sequential);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isValid() const { return valid; }
+#ifndef _WIN32
+    const char* data() const { return mappedData; }
+    std::size_t size() const { return mappedSize; }
+#else
+    const char* data() const { return buffer.data(); }
+    std::size_t size() const { return buffer.size(); }
+#endif
+
+private:
+    bool valid = false;
+#ifndef _WIN32
+    const char* mappedData = nullptr;
+    std::size_t mappedSize = 0;
+#else
+    std::string buffer;
+#endif
+};
@@ -0,0 +1,289 @@
+#include "Pgn.hpp"
+#include "moves/Notation.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <istream>
+#include <ostream>
+
+namespace {
+const char* const START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+Piece::Color opposite(Piece::Color color) {
+    return color == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
+}
+
+bool isSymbolEnd(int c) {
+    return c == EOF || std::isspace(c) || c == '{' || c == '}' || c == '(' || c == ')' ||
+           c == '[' || c == ']' || c == ';';
+}
+}
+
+std::string PgnGame::getTag(const std::string& name) const {
+    for (const auto& tag : tags) {
+        if (tag.first == name) {
+            return tag.second;
+        }
+    }
+    return "";
+}
+
+void PgnGame::setTag(const std::string& name, const std::string& value) {
+    for (auto& tag : tags) {
+        if (tag.first == name) {
+            tag.second = value;
+            return;
+        }
+    }
+    tags.emplace_back(name, value);
+}
+
+bool PgnGame::startPosition(Board& board, Piece::Color& sideToMove) const {
+    const std::string fen = getTag("FEN");
+    return board.setupFromFEN(fen.empty() ? START_FEN : fen, sideToMove);
+}
+
+PgnReader::PgnReader(std::istream& input) : input(input) {
+}
+
+bool PgnReader::readGame(PgnGame& game) {
+    game = PgnGame();
+
+    Board board;
+    Piece::Color sideToMove = Piece::Color::White;
+    bool started = false;
+    bool inMovetext = false;
+
+    while (skipWhitespace()) {
+        const int c = input.peek();
+
+        if (c == '[') {
+            if (inMovetext) {
+                break;
+            }
+            started = true;
+            if (!readTag(game)) {
+                game.error = "Malformed tag";
+            }
+            continue;
+        }
+
+        if (c == '{') {
+            skipComment();
+            continue;
+        }
+        if (c == ';' || c == '%') {
+            skipLine();
+            continue;
+        }
+        if (c == '(') {
+            skipVariation();
+            continue;
+        }
+        if (c == ')' || c == '}' || c == ']') {
+            input.get();
+            continue;
+        }
+
+        std::string token = readSymbol();
+        if (!inMovetext) {
+            inMovetext = true;
+            started = true;
+            if (!game.startPosition(board, sideToMove) && game.error.empty()) {
+                game.error = "Invalid FEN tag";
+            }
+        }
+
+        if (isResult(token)) {
+            game.result = token;
+            break;
+        }
+        if (token[0] == '$') {
+            continue;
+        }
+
+        // Strip a move number ("12.", "12...", "...") but not the zeros of "0-0".
+        std::size_t sanStart = token.find_first_not_of("0123456789");
+        if (sanStart == std::string::npos) {
+            continue;
+        }
+        if (token[sanStart] == '.') {
+            sanStart = token.find_first_not_of('.', sanStart);
+            if (sanStart == std::string::npos) {
+                continue;
+            }
+            token = token.substr(sanStart);
+        }
+
+        if (!game.error.empty()) {
+            continue;
+        }
+        Move move;
+        if (!Notation::parseSan(board, sideToMove, token, move) || !board.applyMove(move)) {
+            game.error = "Illegal or ambiguous move " + token + " at ply " +
+                         std::to_string(game.moves.size() + 1);
+            continue;
+        }
+        game.moves.push_back(move);
+        sideToMove = opposite(sideToMove);
+    }
+
+    if (game.result == "*" && !game.getTag("Result").empty()) {
+        game.result = game.getTag("Result");
+    }
+    return started;
+}
+
+bool PgnReader::skipWhitespace() {
+    while (true) {
+        const int c = input.peek();
+        if (c == EOF) {
+            return false;
+        }
+        if (!std::isspace(c)) {
+            return true;
+        }
+        input.get();
+    }
+}
+
+void PgnReader::skipComment() {
+    int c;
+    while ((c = input.get()) != EOF && c != '}') {
+    }
+}
+
+void PgnReader::skipLine() {
+    int c;
+    while ((c = input.get()) != EOF && c != '\n') {
+    }
+}
+
+void PgnReader::skipVariation() {
+    int depth = 0;
+    int c;
+    while ((c = input.get()) != EOF) {
+        if (c == '(') {
+            depth++;
+        } else if (c == ')') {
+            if (--depth == 0) {
+                return;
+            }
+        } else if (c == '{') {
+            skipComment();
+        } else if (c == ';') {
+            skipLine();
+        }
+    }
+}
+
+bool PgnReader::readTag(PgnGame& game) {
+    input.get();
+
+    std::string name;
+    int c;
+    while ((c = input.get()) != EOF && !std::isspace(c) && c != ']' && c != '"') {
+        name += static_cast<char>(c);
+    }
+    while (c != EOF && c != '"' && c != ']') {
+        c = input.get();
+    }
+
+    std::string value;
+    if (c == '"') {
+        while ((c = input.get()) != EOF && c != '"') {
+            if (c == '\\') {
+                c = input.get();
+            }
+            if (c != EOF) {
+                value += static_cast<char>(c);
+            }
+        }
+        while (c != EOF && c != ']' && c != '\n') {
+            c = input.get();
+        }
+    }
+
+    if (name.empty() || c != ']') {
+        return false;
+    }
+    game.tags.emplace_back(name, value);
+    return true;
+}
+
+std::string PgnReader::readSymbol() {
+    std::string symbol;
+    while (!isSymbolEnd(input.peek())) {
+        symbol += static_cast<char>(input.get());
+    }
+    if (symbol.empty()) {
+        symbol += static_cast<char>(input.get());
+    }
+    return symbol;
+}
+
+bool PgnReader::isResult(const std::string& token) {
+    return token == "1-0" || token == "0-1" || token == "1/2-1/2" || token == "*";
+}
+
+PgnWriter::PgnWriter(std::ostream& output) : output(output) {
+}
+
+bool PgnWriter::writeGame(const PgnGame& game) {
+    Board board;
+    Piece::Color sideToMove = Piece::Color::White;
+    if (!game.startPosition(board, sideToMove)) {
+        return false;
+    }
+
+    for (const auto& tag : game.tags) {
+        output << '[' << tag.first << " \"";
+        for (char c : tag.second) {
+            if (c == '"' || c == '\\') output << '\\';
+            output << c;
+        }
+        output << "\"]\n";
+    }
+    output << '\n';
+
+    int moveNumber = 1;
+    const std::string fen = game.getTag("FEN");
+    if (!fen.empty()) {
+        const std::size_t numberField = fen.find_last_of(' ');
+        if (numberField != std::string::npos) {
+            moveNumber = std::max(1, std::atoi(fen.c_str() + numberField + 1));
+        }
+    }
+
+    std::string line;
+    auto append = [&](const std::string& token) {
+        if (!line.empty() && line.size() + 1 + token.size() > LINE_WIDTH) {
+            output << line << '\n';
+            line.clear();
+        }
+        line += (line.empty() ? "" : " ") + token;
+    };
+
+    for (std::size_t i = 0; i < game.moves.size(); ++i) {
+        const Move& move = game.moves[i];
+        if (sideToMove == Piece::Color::White) {
+            append(std::to_string(moveNumber) + ".");
+        } else if (i == 0) {
+            append(std::to_string(moveNumber) + "...");
+        }
+
+        const std::string san = Notation::toSan(board, sideToMove, move);
+        if (san.empty() || !board.applyMove(move)) {
+            return false;
+        }
+        append(san);
+
+        if (sideToMove == Piece::Color::Black) {
+            moveNumber++;
+        }
+        sideToMove = opposite(sideToMove);
+    }
+    append(game.result);
+    output << line << "\n\n";
+    return static_cast<bool>(output);
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "board/Board.hpp"
+#include "moves/Move.hpp"
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct PgnGame {
+    std::vector<std::pair<std::string, std::string>> tags;
+    std::vector<Move> moves;
+    std::string result = "*";
+    // Set when the movetext could not be replayed; moves holds the legal prefix.
+    std::string error;
+
+    std::string getTag(const std::string& name) const;
+    void setTag(const std::string& name, const std::string& value);
+    // Position the moves start from: the FEN tag if present, the initial position otherwise.
+    bool startPosition(Board& board, Piece::Color& sideToMove) const;
+};
+
+// Reads one game at a time from a stream, so memory is bounded by the largest
+// game rather than the archive. Comments, NAGs and variations are skipped.
+class PgnReader {
+public:
+    explicit PgnReader(std::istream& input);
+
+    // Returns false once the input holds no further game.
+    bool readGame(PgnGame& game);
+
+private:
+    std::istream& input;
+
+    bool skipWhitespace();
+    void skipComment();
+    void skipLine();
+    void skipVariation();
+    bool readTag(PgnGame& game);
+    std::string readSymbol();
+    static bool isResult(const std::string& token);
+};
+
+class PgnWriter {
+public:
+    explicit PgnWriter(std::ostream& output);
+
+    bool writeGame(const PgnGame& game);
+
+private:
+    static const std::size_t LINE_WIDTH = 80;
+
+    std::ostream& output;
+};
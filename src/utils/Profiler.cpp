@@ -0,0 +1,113 @@
+#include "Profiler.hpp"
+
+#ifdef CHESS_PROFILE
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+struct Totals {
+    std::uint64_t calls[Profiler::MAX_SITES] = {};
+    std::uint64_t nanos[Profiler::MAX_SITES] = {};
+
+    void add(const Totals& other) {
+        for (int i = 0; i < Profiler::MAX_SITES; ++i) {
+            calls[i] += other.calls[i];
+            nanos[i] += other.nanos[i];
+        }
+    }
+};
+
+// Process-wide: site names and the totals of threads that have exited.
+// Destroyed after every thread_local, so it prints the complete profile.
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::string> names;
+    Totals merged;
+
+    ~Registry() {
+        if (!names.empty()) {
+            print(std::cerr, merged);
+        }
+    }
+
+    void print(std::ostream& output, const Totals& totals) {
+        std::vector<int> order;
+        for (int i = 0; i < static_cast<int>(names.size()); ++i) {
+            if (totals.calls[i] > 0) {
+                order.push_back(i);
+            }
+        }
+        std::sort(order.begin(), order.end(), [&](int a, int b) { return totals.nanos[a] > totals.nanos[b]; });
+
+        output << "Profile (inclusive wall time)\n"
+               << std::left << std::setw(40) << "site" << std::right << std::setw(14) << "calls"
+               << std::setw(14) << "total ms" << std::setw(12) << "avg ns" << '\n';
+        for (int i : order) {
+            output << std::left << std::setw(40) << names[i] << std::right << std::setw(14) << totals.calls[i];
+            if (totals.nanos[i] == 0) {
+                // PROFILE_COUNT sites have no timing.
+                output << std::setw(14) << '-' << std::setw(12) << '-' << '\n';
+                continue;
+            }
+            output << std::setw(14) << std::fixed << std::setprecision(1) << totals.nanos[i] / 1e6
+                   << std::setw(12) << totals.nanos[i] / totals.calls[i] << '\n';
+        }
+        output.flush();
+    }
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+struct ThreadTotals : Totals {
+    ~ThreadTotals() {
+        Registry& shared = registry();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        shared.merged.add(*this);
+    }
+};
+
+thread_local ThreadTotals threadTotals;
+}
+
+Profiler::Site::Site(const char* name) {
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    auto existing = std::find(shared.names.begin(), shared.names.end(), name);
+    if (existing != shared.names.end()) {
+        index = static_cast<int>(existing - shared.names.begin());
+    } else if (shared.names.size() < static_cast<std::size_t>(MAX_SITES)) {
+        index = static_cast<int>(shared.names.size());
+        shared.names.push_back(name);
+    } else {
+        index = -1;
+    }
+}
+
+void Profiler::count(const Site& site) {
+    if (site.getIndex() >= 0) {
+        threadTotals.calls[site.getIndex()]++;
+    }
+}
+
+void Profiler::record(int index, std::chrono::steady_clock::duration elapsed) {
+    if (index >= 0) {
+        threadTotals.calls[index]++;
+        threadTotals.nanos[index] += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+}
+
+void Profiler::report(std::ostream& output) {
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    Totals totals = shared.merged;
+    totals.add(threadTotals);
+    shared.print(output, totals);
+}
+#endif
@@ -0,0 +1,68 @@
+#pragma once
+
+// Scoped wall-clock timers and event counters for the hot paths. Built only
+// with -DCHESS_PROFILE=ON; otherwise PROFILE_SCOPE and PROFILE_COUNT expand to
+// nothing. Each thread accumulates into its own table, merged when the thread
+// exits; the totals are printed to std::cerr when the program ends.
+//
+//     PROFILE_SCOPE("MoveGenerator::generateAllMoves");
+//     PROFILE_COUNT("AI::negamax cutoff");
+
+#ifdef CHESS_PROFILE
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+
+class Profiler {
+public:
+    static const int MAX_SITES = 64;
+
+    // One per instrumentation point, registered on first use.
+    class Site {
+    public:
+        explicit Site(const char* name);
+        int getIndex() const { return index; }
+
+    private:
+        int index;
+    };
+
+    class Scope {
+    public:
+        explicit Scope(const Site& site)
+            : index(site.getIndex())
+            , start(std::chrono::steady_clock::now()) {
+        }
+        ~Scope() { record(index, std::chrono::steady_clock::now() - start); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        int index;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    static void count(const Site& site);
+    // Totals of finished threads plus the calling thread's, inclusive of nested scopes.
+    static void report(std::ostream& output);
+
+private:
+    static void record(int index, std::chrono::steady_clock::duration elapsed);
+};
+
+#define CHESS_PROFILE_CONCAT_INNER(a, b) a##b
+#define CHESS_PROFILE_CONCAT(a, b) CHESS_PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name)                                                                   \
+    static const Profiler::Site CHESS_PROFILE_CONCAT(profileSite, __LINE__)(name);           \
+    const Profiler::Scope CHESS_PROFILE_CONCAT(profileScope, __LINE__)(                      \
+        CHESS_PROFILE_CONCAT(profileSite, __LINE__))
+#define PROFILE_COUNT(name)                                                                   \
+    do {                                                                                      \
+        static const Profiler::Site profileCounter(name);                                     \
+        Profiler::count(profileCounter);                                                      \
+    } while (0)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_COUNT(name) ((void)0)
+#endif
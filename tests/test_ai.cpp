@@ -1,10 +1,16 @@
 #include <gtest/gtest.h>
 #include "ai/AI.hpp"
+#include "ai/Ponder.hpp"
+#include "ai/OpeningBook.hpp"
+#include "ai/Tablebase.hpp"
 #include "board/Board.hpp"
 #include "pieces/King.hpp"
 #include "pieces/Queen.hpp"
 #include "pieces/Pawn.hpp"
 #include "moves/MoveGenerator.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 
 class AITest : public ::testing::Test {
 protected:
@@ -34,8 +40,8 @@ TEST_F(AITest, InitialPosition) {
 
 TEST_F(AITest, HandleCheck) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Queen(Piece::Color::Black), Position("e8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Queen(Piece::Color::Black), Position("e8"));
     
     Move move = ai->getMove(board, Piece::Color::White);
     
@@ -50,9 +56,9 @@ TEST_F(AITest, HandleCheck) {
 
 TEST_F(AITest, HandleCheckmate) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("h1"));
-    board->placePiece(new Queen(Piece::Color::Black), Position("f1"));
-    board->placePiece(new Queen(Piece::Color::Black), Position("g2"));
+    board->placePiece(King(Piece::Color::White), Position("h1"));
+    board->placePiece(Queen(Piece::Color::Black), Position("f1"));
+    board->placePiece(Queen(Piece::Color::Black), Position("g2"));
     
     Move move = ai->getMove(board, Piece::Color::White);
     EXPECT_FALSE(move.getFrom().isValid()) 
@@ -61,8 +67,8 @@ TEST_F(AITest, HandleCheckmate) {
 
 TEST_F(AITest, HandleStalemate) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("h1"));
-    board->placePiece(new Queen(Piece::Color::Black), Position("f2"));
+    board->placePiece(King(Piece::Color::White), Position("h1"));
+    board->placePiece(Queen(Piece::Color::Black), Position("f2"));
     
     Move move = ai->getMove(board, Piece::Color::White);
     EXPECT_FALSE(move.getFrom().isValid()) 
@@ -88,9 +94,9 @@ TEST_F(AITest, HandleEmptyBoard) {
 
 TEST_F(AITest, HandlePawnPromotion) {
     board->clear();
-    board->placePiece(new Pawn(Piece::Color::White), Position("e7"));
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new King(Piece::Color::Black), Position("h8"));
+    board->placePiece(Pawn(Piece::Color::White), Position("e7"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(King(Piece::Color::Black), Position("h8"));
     
     Move move = ai->getMove(board, Piece::Color::White);
     EXPECT_TRUE(move.getFrom() == Position("e7"));
@@ -132,4 +138,337 @@ TEST_F(AITest, DifferentBehaviorWithDifferentSeeds) {
     
     EXPECT_TRUE(foundDifferentMoves) 
         << "Different seeds should produce different moves";
-}
\ No newline at end of file
+}
+
+TEST_F(AITest, PonderHitReturnsSearchedMove) {
+    board->initialize();
+    AI predictor;
+    predictor.setDepth(1);
+    Move reply = predictor.getMove(board, Piece::Color::White);
+    Board afterReply(*board);
+    ASSERT_TRUE(afterReply.applyMove(reply));
+
+    Ponder ponder;
+    ponder.start(*board, Piece::Color::White, 2);
+
+    Move pondered;
+    ASSERT_TRUE(ponder.takeMove(afterReply, Piece::Color::Black, pondered));
+
+    AI searcher;
+    searcher.setDepth(2);
+    EXPECT_EQ(pondered, searcher.getMove(&afterReply, Piece::Color::Black));
+}
+
+TEST_F(AITest, PonderMissIsCancelled) {
+    board->initialize();
+    Ponder ponder;
+    ponder.start(*board, Piece::Color::White, 2);
+
+    Board afterReply(*board);
+    ASSERT_TRUE(afterReply.applyMove(Move(Position("h2"), Position("h3"))));
+
+    Move pondered;
+    EXPECT_FALSE(ponder.takeMove(afterReply, Piece::Color::Black, pondered));
+    EXPECT_FALSE(ponder.isRunning());
+}
+
+TEST_F(AITest, BookMoveSkipsSearch) {
+    board->initialize();
+    const std::uint64_t key = OpeningBook::hash(board, Piece::Color::White);
+    const Move e4(Position("e2"), Position("e4"), Move::Type::DoublePawn);
+    const Move d4(Position("d2"), Position("d4"), Move::Type::DoublePawn);
+
+    const std::string path = ::testing::TempDir() + "book_test.bin";
+    OpeningBook::Entry unrelated;
+    unrelated.key = key + 1;
+    unrelated.move = OpeningBook::encodeMove(d4, board);
+    unrelated.weight = 10;
+    OpeningBook::Entry never = unrelated;
+    never.key = key;
+    never.weight = 0;
+    OpeningBook::Entry always = never;
+    always.move = OpeningBook::encodeMove(e4, board);
+    always.weight = 5;
+    ASSERT_TRUE(OpeningBook::write(path, {unrelated, always, never}));
+
+    OpeningBook book;
+    ASSERT_TRUE(book.open(path));
+    EXPECT_EQ(book.size(), 3u);
+    EXPECT_EQ(book.lookup(key).size(), 2u);
+
+    ai->setOpeningBook(&book);
+    AI::SearchResult result = ai->search(board, Piece::Color::White);
+    EXPECT_EQ(result.move.getFrom(), Position("e2"));
+    EXPECT_EQ(result.move.getTo(), Position("e4"));
+    EXPECT_EQ(result.stats.nodes, 0u);
+
+    Board afterMove(*board);
+    ASSERT_TRUE(afterMove.applyMove(e4));
+    EXPECT_NE(OpeningBook::hash(&afterMove, Piece::Color::Black), key);
+    std::mt19937 rng(1);
+    Move miss;
+    EXPECT_FALSE(book.probe(&afterMove, Piece::Color::Black, rng, miss));
+
+    book.close();
+    std::remove(path.c_str());
+}
+
+TEST_F(AITest, BookMovesUsePolyglotEncoding) {
+    board->initialize();
+    EXPECT_EQ(OpeningBook::encodeMove(Move(Position("e2"), Position("e4")), board), 796);
+
+    Piece::Color side;
+    ASSERT_TRUE(board->setupFromFEN("r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1", side));
+    const std::uint16_t castle = OpeningBook::encodeMove(
+        Move(Position("e1"), Position("g1"), Move::Type::Castling), board);
+    EXPECT_EQ(castle & 63, Position("h1").toIndex());
+
+    Move decoded;
+    ASSERT_TRUE(OpeningBook::decodeMove(castle, board, Piece::Color::White, decoded));
+    EXPECT_EQ(decoded.getTo(), Position("g1"));
+    EXPECT_FALSE(OpeningBook::decodeMove(castle, board, Piece::Color::Black, decoded));
+
+    Board noRights(*board);
+    noRights.setCastlingRights(0);
+    EXPECT_NE(OpeningBook::hash(&noRights, Piece::Color::White),
+              OpeningBook::hash(board, Piece::Color::White));
+}
+
+TEST_F(AITest, BookHashMatchesPolyglotKeys) {
+    board->initialize();
+    EXPECT_EQ(OpeningBook::hash(board, Piece::Color::White), 0x463b96181691fc9cULL);
+
+    ASSERT_TRUE(board->applyMove(Move(Position("e2"), Position("e4"), Move::Type::DoublePawn)));
+    EXPECT_EQ(OpeningBook::hash(board, Piece::Color::Black), 0x823c9b50fd114196ULL);
+
+    ASSERT_TRUE(board->applyMove(Move(Position("d7"), Position("d5"), Move::Type::DoublePawn)));
+    EXPECT_EQ(OpeningBook::hash(board, Piece::Color::White), 0x0756b94461c50fb0ULL);
+
+    Piece::Color side;
+    ASSERT_TRUE(board->setupFromFEN("rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3", side));
+    EXPECT_EQ(OpeningBook::hash(board, side), 0x22a48b5a8e47ff78ULL);
+    ASSERT_TRUE(board->setupFromFEN("rnbqkbnr/p1pppppp/8/8/P6P/R1p5/1P1PPPP1/1NBQKBNR b Kkq - 0 4", side));
+    EXPECT_EQ(OpeningBook::hash(board, side), 0x5c3f9b829b279560ULL);
+}
+
+TEST_F(AITest, TablebaseProbesThreePieceEndings) {
+    const struct {
+        const char* fen;
+        Tablebase::Wdl expected;
+    } cases[] = {
+        {"3k4/8/3K4/8/3P4/8/8/8 w - - 0 1", Tablebase::Wdl::Win},
+        {"3k4/8/3K4/8/3P4/8/8/8 b - - 0 1", Tablebase::Wdl::Loss},
+        {"8/8/8/3p4/8/3k4/8/3K4 w - - 0 1", Tablebase::Wdl::Loss},
+        {"k7/8/8/PK6/8/8/8/8 w - - 0 1", Tablebase::Wdl::Draw},
+        {"8/8/8/8/4P3/5k2/8/K7 b - - 0 1", Tablebase::Wdl::Draw},
+        {"k7/8/1Q6/8/8/8/8/7K b - - 0 1", Tablebase::Wdl::Draw},
+        {"k7/8/1Q6/8/8/8/8/7K w - - 0 1", Tablebase::Wdl::Win},
+        {"8/8/8/4k3/3R4/8/8/K7 b - - 0 1", Tablebase::Wdl::Draw},
+        {"8/8/8/4k3/8/8/3R4/K7 b - - 0 1", Tablebase::Wdl::Loss},
+        {"8/8/8/4k3/8/8/3N4/K7 w - - 0 1", Tablebase::Wdl::Draw},
+    };
+
+    for (const auto& testCase : cases) {
+        Piece::Color side;
+        ASSERT_TRUE(board->setupFromFEN(testCase.fen, side)) << testCase.fen;
+        Tablebase::Wdl wdl;
+        ASSERT_TRUE(Tablebase::probeWdl(board, side, wdl)) << testCase.fen;
+        EXPECT_EQ(wdl, testCase.expected) << testCase.fen;
+    }
+
+    board->initialize();
+    Tablebase::Wdl wdl;
+    EXPECT_FALSE(Tablebase::probeWdl(board, Piece::Color::White, wdl));
+}
+
+TEST_F(AITest, TablebaseKeepsWinningMove) {
+    Piece::Color side;
+    ASSERT_TRUE(board->setupFromFEN("3k4/8/3K4/8/3P4/8/8/8 w - - 0 1", side));
+    ai->setDepth(2);
+    Move move = ai->getMove(board, side);
+
+    Board afterMove(*board);
+    ASSERT_TRUE(afterMove.applyMove(move));
+    Tablebase::Wdl wdl;
+    ASSERT_TRUE(Tablebase::probeWdl(&afterMove, Piece::Color::Black, wdl));
+    EXPECT_EQ(wdl, Tablebase::Wdl::Loss);
+}
+
+// A KQvK table whose every index holds one value per side to move: the header,
+// the piece order K Q k for both sides, then a single-value record per side,
+// padded the way the generator pads files.
+static void writeKqvkTable(const std::string& path, bool dtz, std::vector<std::uint8_t> records) {
+    static const std::uint8_t WDL_MAGIC[4] = {0x71, 0xE8, 0x23, 0x5D};
+    static const std::uint8_t DTZ_MAGIC[4] = {0xD7, 0x66, 0x0C, 0xA5};
+    const std::uint8_t* magic = dtz ? DTZ_MAGIC : WDL_MAGIC;
+    std::vector<std::uint8_t> bytes = {magic[0], magic[1], magic[2], magic[3], 0x01, 0x00, 0x66, 0x55, 0xEE, 0x00};
+    bytes.insert(bytes.end(), records.begin(), records.end());
+    bytes.resize(80, 0);
+    std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+
+TEST_F(AITest, SyzygyTablesTakePrecedence) {
+    const std::string dir = ::testing::TempDir() + "syzygy_test";
+    std::filesystem::create_directories(dir);
+    // Queen side to move: win; the lone king to move: draw. DTZ is stored for the queen side only.
+    writeKqvkTable(dir + "/KQvK.rtbw", false, {0x80, 4, 0x80, 2});
+    writeKqvkTable(dir + "/KQvK.rtbz", true, {0x80, 5});
+    ASSERT_EQ(Tablebase::setSyzygyPath(dir), 1);
+    EXPECT_EQ(Syzygy::maxPieces(), 3);
+
+    const struct {
+        const char* fen;
+        Syzygy::Wdl expected;
+        int dtz;
+    } cases[] = {
+        {"8/8/8/4k3/8/8/8/Q6K w - - 0 1", Syzygy::Wdl::Win, 11},
+        {"8/8/8/4k3/8/8/8/Q6K b - - 0 1", Syzygy::Wdl::Draw, 0},
+        {"q6k/8/8/8/4K3/8/8/8 b - - 0 1", Syzygy::Wdl::Win, 11},
+        {"q6k/8/8/8/4K3/8/8/8 w - - 0 1", Syzygy::Wdl::Draw, 0},
+    };
+    for (const auto& testCase : cases) {
+        Piece::Color side;
+        ASSERT_TRUE(board->setupFromFEN(testCase.fen, side)) << testCase.fen;
+        Syzygy::Wdl wdl;
+        ASSERT_TRUE(Syzygy::probeWdl(board, side, wdl)) << testCase.fen;
+        EXPECT_EQ(wdl, testCase.expected) << testCase.fen;
+        int dtz = -1;
+        ASSERT_TRUE(Syzygy::probeDtz(board, side, dtz)) << testCase.fen;
+        EXPECT_EQ(dtz, testCase.dtz) << testCase.fen;
+    }
+
+    // The builtin code scores this as a loss; the table wins, material it lacks still falls back.
+    Piece::Color side;
+    ASSERT_TRUE(board->setupFromFEN("8/8/8/4k3/8/8/8/Q6K b - - 0 1", side));
+    Tablebase::Wdl wdl;
+    ASSERT_TRUE(Tablebase::probeWdl(board, side, wdl));
+    EXPECT_EQ(wdl, Tablebase::Wdl::Draw);
+    ASSERT_TRUE(board->setupFromFEN("8/8/8/4k3/8/8/3R4/K7 b - - 0 1", side));
+    ASSERT_TRUE(Tablebase::probeWdl(board, side, wdl));
+    EXPECT_EQ(wdl, Tablebase::Wdl::Loss);
+
+    ASSERT_EQ(Tablebase::setSyzygyPath(""), 0);
+    ASSERT_TRUE(board->setupFromFEN("8/8/8/4k3/8/8/8/Q6K b - - 0 1", side));
+    Syzygy::Wdl unused;
+    EXPECT_FALSE(Syzygy::probeWdl(board, side, unused));
+    ASSERT_TRUE(Tablebase::probeWdl(board, side, wdl));
+    EXPECT_EQ(wdl, Tablebase::Wdl::Loss);
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_F(AITest, CorruptSyzygyTableFallsBackToBuiltin) {
+    const std::string dir = ::testing::TempDir() + "syzygy_corrupt_test";
+    std::filesystem::create_directories(dir);
+    writeKqvkTable(dir + "/KQvK.rtbw", true, {0x80, 4, 0x80, 2});
+    ASSERT_EQ(Tablebase::setSyzygyPath(dir), 1);
+
+    Piece::Color side;
+    ASSERT_TRUE(board->setupFromFEN("8/8/8/4k3/8/8/8/Q6K b - - 0 1", side));
+    Syzygy::Wdl unused;
+    EXPECT_FALSE(Syzygy::probeWdl(board, side, unused));
+    Tablebase::Wdl wdl;
+    ASSERT_TRUE(Tablebase::probeWdl(board, side, wdl));
+    EXPECT_EQ(wdl, Tablebase::Wdl::Loss);
+
+    Tablebase::setSyzygyPath("");
+    std::filesystem::remove_all(dir);
+}
+
+TEST_F(AITest, SearchReportsStatsPerIteration) {
+    board->initialize();
+    ai->setDepth(3);
+    std::vector<AI::SearchResult> iterations;
+    ai->setIterationCallback([&](const AI::SearchResult& result) { iterations.push_back(result); });
+
+    AI::SearchResult result = ai->search(board, Piece::Color::White);
+    ASSERT_EQ(iterations.size(), 3u);
+    for (std::size_t i = 0; i < iterations.size(); ++i) {
+        EXPECT_EQ(iterations[i].depth, static_cast<int>(i) + 1);
+        EXPECT_GE(iterations[i].stats.selectiveDepth, static_cast<int>(i) + 1);
+        if (i > 0) {
+            EXPECT_GT(iterations[i].stats.nodes, iterations[i - 1].stats.nodes);
+        }
+    }
+
+    EXPECT_EQ(result.stats.nodes, iterations.back().stats.nodes);
+    EXPECT_GT(result.stats.cutoffs(), 0u);
+    EXPECT_GT(result.stats.cutoffIndex[0], 0u);
+    EXPECT_GT(result.stats.nodesPerSecond(), 0u);
+}
+
+TEST_F(AITest, ExtensionsFindMateBehindCheck) {
+    Piece::Color side;
+    ASSERT_TRUE(board->setupFromFEN("6k1/4rppp/8/8/8/8/5PPP/1R1R2K1 w - - 0 1", side));
+    ai->setDepth(2);
+
+    // Rb8+ Re8 Rxe8# is four plies; the check and the forced block extend it to fit depth 2.
+    AI::SearchResult result = ai->search(board, side);
+    EXPECT_EQ(result.score, AI::MATE_SCORE - 3);
+    EXPECT_EQ(AI::mateInMoves(result.score), 2);
+    EXPECT_EQ(result.move.getTo().getY(), 7);
+    EXPECT_GT(result.stats.extensions, 0u);
+}
+
+TEST_F(AITest, PruningKeepsMateWhenBehindOnMaterial) {
+    Piece::Color side;
+    ASSERT_TRUE(board->setupFromFEN("6k1/5ppp/8/8/8/1q6/5PPP/4R1K1 w - - 0 1", side));
+    ai->setDepth(3);
+
+    // White is a queen down, so futility would drop quiet moves, but Re8# gives check.
+    AI::SearchResult result = ai->search(board, side);
+    EXPECT_EQ(result.move.toAlgebraic(), "e1e8");
+    EXPECT_EQ(result.score, AI::MATE_SCORE - 1);
+    EXPECT_EQ(AI::mateInMoves(result.score), 1);
+}
+
+TEST_F(AITest, MultiPvReturnsBestRootMovesInOrder) {
+    Piece::Color side;
+    ASSERT_TRUE(board->setupFromFEN("6k1/5ppp/8/8/8/1q6/5PPP/4R1K1 w - - 0 1", side));
+    ai->setDepth(2);
+    AI::SearchResult single = ai->search(board, side);
+    ASSERT_EQ(single.lines.size(), 1u);
+
+    ai->setMultiPv(3);
+    AI::SearchResult result = ai->search(board, side);
+    ASSERT_EQ(result.lines.size(), 3u);
+    EXPECT_EQ(result.move, single.move);
+    EXPECT_EQ(result.score, single.score);
+    EXPECT_EQ(result.lines[0].move, result.move);
+
+    for (std::size_t i = 0; i < result.lines.size(); ++i) {
+        const AI::PvLine& line = result.lines[i];
+        ASSERT_FALSE(line.pv.empty());
+        EXPECT_EQ(line.pv.front(), line.move);
+        if (i > 0) {
+            EXPECT_GE(result.lines[i - 1].score, line.score);
+            EXPECT_NE(result.lines[i - 1].move, line.move);
+        }
+    }
+}
+
+TEST_F(AITest, PrincipalVariationIsReportedPerIteration) {
+    board->initialize();
+    ai->setDepth(3);
+    std::vector<AI::SearchResult> iterations;
+    ai->setIterationCallback([&](const AI::SearchResult& result) { iterations.push_back(result); });
+
+    AI::SearchResult result = ai->search(board, Piece::Color::White);
+    ASSERT_EQ(iterations.size(), 3u);
+    for (const AI::SearchResult& iteration : iterations) {
+        ASSERT_FALSE(iteration.lines.empty());
+        const std::vector<Move>& pv = iteration.lines.front().pv;
+        EXPECT_GE(pv.size(), static_cast<std::size_t>(iteration.depth));
+        EXPECT_EQ(pv.front(), iteration.move);
+
+        Board line(*board);
+        Piece::Color side = Piece::Color::White;
+        for (const Move& move : pv) {
+            ASSERT_TRUE(MoveGenerator::isMoveLegal(&line, move)) << move.toAlgebraic();
+            ASSERT_EQ(line.getSquare(move.getFrom())->getPiece()->getColor(), side);
+            ASSERT_TRUE(line.applyMove(move));
+            side = side == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
+        }
+    }
+    EXPECT_EQ(result.lines.front().pv, iterations.back().lines.front().pv);
+}
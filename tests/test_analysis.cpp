@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include "analysis/BatchAnalyzer.hpp"
+#include "analysis/MatchRunner.hpp"
+#include "analysis/Bench.hpp"
+#include <cmath>
+#include <sstream>
+
+TEST(BatchAnalyzerTest, ParsesEpdWithId) {
+    std::string fen;
+    std::string id;
+    ASSERT_TRUE(BatchAnalyzer::parseLine(
+        "6k1/5ppp/8/8/8/8/8/R5K1 w - - bm Ra8#; id \"back rank\";", fen, id));
+
+    EXPECT_EQ(fen, "6k1/5ppp/8/8/8/8/8/R5K1 w - -");
+    EXPECT_EQ(id, "back rank");
+}
+
+TEST(BatchAnalyzerTest, ParsesFen) {
+    std::string fen;
+    std::string id;
+    ASSERT_TRUE(BatchAnalyzer::parseLine(
+        "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1", fen, id));
+
+    EXPECT_EQ(fen, "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1");
+    EXPECT_TRUE(id.empty());
+    EXPECT_FALSE(BatchAnalyzer::parseLine("8/8/8 w", fen, id));
+}
+
+TEST(BatchAnalyzerTest, AnalysesEveryValidLine) {
+    std::istringstream input(
+        "6k1/5ppp/8/8/8/8/8/R5K1 w - - id \"mate\";\n"
+        "\n"
+        "not a position\n"
+        "4k3/8/8/8/8/8/8/4K2R w K - 0 1\n");
+    std::ostringstream output;
+
+    BatchAnalyzer::Options options;
+    options.depth = 2;
+    options.threads = 2;
+    options.format = BatchAnalyzer::Format::Jsonl;
+    BatchAnalyzer analyzer(options);
+
+    EXPECT_EQ(analyzer.run(input, output), 2u);
+    const std::string text = output.str();
+    EXPECT_NE(text.find("\"id\":\"mate\",\"fen\":\"6k1/5ppp/8/8/8/8/8/R5K1 w - -\""), std::string::npos);
+    EXPECT_NE(text.find("\"depth\":2"), std::string::npos);
+    EXPECT_NE(text.find("\"line\":4"), std::string::npos);
+    EXPECT_NE(text.find("\"pv\":\"a1a8"), std::string::npos);
+}
+
+TEST(BatchAnalyzerTest, JsonEscapesControlCharacters) {
+    BatchAnalyzer::Result result;
+    result.line = 1;
+    result.id = "tab\there\nquote\"\x01";
+    result.fen = "8/8/8/8/8/8/8/K6k w - -";
+    std::ostringstream output;
+
+    BatchAnalyzer::writeResult(output, BatchAnalyzer::Format::Jsonl, result);
+    EXPECT_NE(output.str().find("\"id\":\"tab\\there\\nquote\\\"\\u0001\""), std::string::npos)
+        << output.str();
+}
+
+TEST(BatchAnalyzerTest, ScoresAreCentipawnsOrMoves) {
+    BatchAnalyzer::Result result;
+    result.line = 1;
+    result.fen = "4k3/8/8/8/8/8/8/R3K3 w - -";
+    result.search.score = 1030;
+    std::ostringstream csv;
+    BatchAnalyzer::writeResult(csv, BatchAnalyzer::Format::Csv, result);
+    EXPECT_NE(csv.str().find(",0000,515,,"), std::string::npos) << csv.str();
+
+    result.search.score = AI::MATE_SCORE - 1;
+    std::ostringstream json;
+    BatchAnalyzer::writeResult(json, BatchAnalyzer::Format::Jsonl, result);
+    EXPECT_NE(json.str().find("\"score_cp\":null,\"mate\":1,"), std::string::npos) << json.str();
+
+    result.search.score = 2 - AI::MATE_SCORE;
+    std::ostringstream mated;
+    BatchAnalyzer::writeResult(mated, BatchAnalyzer::Format::Csv, result);
+    EXPECT_NE(mated.str().find(",0000,,-1,"), std::string::npos) << mated.str();
+}
+
+TEST(MatchRunnerTest, EloAndSprtFromCounts) {
+    MatchStats stats;
+    stats.wins = 60;
+    stats.losses = 40;
+    EXPECT_NEAR(stats.eloDifference(), 70.4, 0.1);
+    EXPECT_GT(stats.eloError(), 0.0);
+
+    stats.wins = stats.losses = stats.draws = 50;
+    EXPECT_NEAR(stats.eloDifference(), 0.0, 1e-9);
+    EXPECT_LT(stats.logLikelihoodRatio(0.0, 10.0), 0.0);
+
+    stats.wins = 300;
+    stats.losses = 100;
+    stats.draws = 0;
+    EXPECT_GT(stats.logLikelihoodRatio(0.0, 10.0), std::log(0.95 / 0.05));
+}
+
+TEST(MatchRunnerTest, PlaysEveryGame) {
+    MatchRunner::Options options;
+    options.engineA.depth = 1;
+    options.engineB.depth = 1;
+    options.games = 4;
+    options.threads = 2;
+    options.maxPlies = 6;
+    MatchRunner runner(options);
+
+    const MatchRunner::Result result = runner.run({
+        "4k3/8/8/8/8/8/4P3/4K3 w - - 0 1",
+        "4k3/4p3/8/8/8/8/8/4K3 b - - 0 1",
+    });
+    EXPECT_EQ(result.stats.games(), 4u);
+    EXPECT_EQ(result.verdict, MatchRunner::Verdict::None);
+}
+
+TEST(BenchTest, NodeCountIsReproducible) {
+    std::ostringstream first;
+    std::ostringstream second;
+    const Bench::Result a = Bench::run(first, 1);
+    const Bench::Result b = Bench::run(second, 1);
+
+    EXPECT_EQ(a.positions, Bench::positions().size());
+    EXPECT_GT(a.nodes, 0u);
+    EXPECT_EQ(a.nodes, b.nodes);
+    EXPECT_NE(first.str().find("Nodes searched  : " + std::to_string(a.nodes)), std::string::npos);
+}
@@ -33,10 +33,10 @@ protected:
 
 TEST_F(ComplexCasesTest, DoubleCheck) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Bishop(Piece::Color::Black), Position("c3"));
-    board->placePiece(new Knight(Piece::Color::Black), Position("d3"));
-    board->placePiece(new King(Piece::Color::Black), Position("h8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Bishop(Piece::Color::Black), Position("c3"));
+    board->placePiece(Knight(Piece::Color::Black), Position("d3"));
+    board->placePiece(King(Piece::Color::Black), Position("h8"));
 
     auto allMoves = MoveGenerator::generateAllMoves(board, Piece::Color::White);
     
@@ -51,11 +51,11 @@ TEST_F(ComplexCasesTest, DoubleCheck) {
 
 TEST_F(ComplexCasesTest, StalemateDueToPins) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("h1")); 
-    board->placePiece(new Pawn(Piece::Color::White), Position("h2")); 
-    board->placePiece(new Pawn(Piece::Color::Black), Position("h3")); 
-    board->placePiece(new Queen(Piece::Color::Black), Position("f2")); 
-    board->placePiece(new King(Piece::Color::Black), Position("e4")); 
+    board->placePiece(King(Piece::Color::White), Position("h1")); 
+    board->placePiece(Pawn(Piece::Color::White), Position("h2")); 
+    board->placePiece(Pawn(Piece::Color::Black), Position("h3")); 
+    board->placePiece(Queen(Piece::Color::Black), Position("f2")); 
+    board->placePiece(King(Piece::Color::Black), Position("e4")); 
 
     EXPECT_FALSE(board->isCheck(Piece::Color::White))
         << "Position should not be check for stalemate";
@@ -76,11 +76,11 @@ TEST_F(ComplexCasesTest, StalemateDueToPins) {
 
 TEST_F(ComplexCasesTest, EnPassantPinAndCheck) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("e5"));
-    board->placePiece(new Pawn(Piece::Color::Black), Position("f5"));
-    board->placePiece(new Rook(Piece::Color::Black), Position("e8"));
-    board->placePiece(new King(Piece::Color::Black), Position("h8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Pawn(Piece::Color::White), Position("e5"));
+    board->placePiece(Pawn(Piece::Color::Black), Position("f5"));
+    board->placePiece(Rook(Piece::Color::Black), Position("e8"));
+    board->placePiece(King(Piece::Color::Black), Position("h8"));
     
     board->setEnPassantPosition(Position("f6"));
     
@@ -100,11 +100,11 @@ TEST_F(ComplexCasesTest, EnPassantPinAndCheck) {
 
 TEST_F(ComplexCasesTest, CastlingThroughCheckAndPin) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Rook(Piece::Color::White), Position("h1"));
-    board->placePiece(new Rook(Piece::Color::Black), Position("e8")); 
-    board->placePiece(new Bishop(Piece::Color::Black), Position("b4")); 
-    board->placePiece(new King(Piece::Color::Black), Position("h8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Rook(Piece::Color::White), Position("h1"));
+    board->placePiece(Rook(Piece::Color::Black), Position("e8")); 
+    board->placePiece(Bishop(Piece::Color::Black), Position("b4")); 
+    board->placePiece(King(Piece::Color::Black), Position("h8"));
 
     auto kingMoves = MoveGenerator::generateLegalMoves(board, Position("e1"));
     
@@ -123,11 +123,11 @@ TEST_F(ComplexCasesTest, CastlingThroughCheckAndPin) {
 
 TEST_F(ComplexCasesTest, ComplexPawnPromotion) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("e7"));
-    board->placePiece(new Rook(Piece::Color::Black), Position("f8")); 
-    board->placePiece(new Bishop(Piece::Color::Black), Position("d8")); 
-    board->placePiece(new King(Piece::Color::Black), Position("h8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Pawn(Piece::Color::White), Position("e7"));
+    board->placePiece(Rook(Piece::Color::Black), Position("f8")); 
+    board->placePiece(Bishop(Piece::Color::Black), Position("d8")); 
+    board->placePiece(King(Piece::Color::Black), Position("h8"));
 
     auto pawnMoves = MoveGenerator::generateLegalMoves(board, Position("e7"));
     
@@ -159,11 +159,11 @@ TEST_F(ComplexCasesTest, ComplexPawnPromotion) {
 
 TEST_F(ComplexCasesTest, ComplexCheckDefense) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Queen(Piece::Color::White), Position("d1"));
-    board->placePiece(new Bishop(Piece::Color::Black), Position("h4")); 
-    board->placePiece(new Rook(Piece::Color::Black), Position("d8")); 
-    board->placePiece(new King(Piece::Color::Black), Position("h8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Queen(Piece::Color::White), Position("d1"));
+    board->placePiece(Bishop(Piece::Color::Black), Position("h4")); 
+    board->placePiece(Rook(Piece::Color::Black), Position("d8")); 
+    board->placePiece(King(Piece::Color::Black), Position("h8"));
 
     EXPECT_TRUE(board->isCheck(Piece::Color::White))
         << "Position should be check";
@@ -187,10 +187,10 @@ TEST_F(ComplexCasesTest, ComplexCheckDefense) {
 
 TEST_F(ComplexCasesTest, LongDiagonalBlockage) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("h1"));
-    board->placePiece(new Bishop(Piece::Color::White), Position("f3"));
-    board->placePiece(new Queen(Piece::Color::Black), Position("a8")); 
-    board->placePiece(new King(Piece::Color::Black), Position("h8"));
+    board->placePiece(King(Piece::Color::White), Position("h1"));
+    board->placePiece(Bishop(Piece::Color::White), Position("f3"));
+    board->placePiece(Queen(Piece::Color::Black), Position("a8")); 
+    board->placePiece(King(Piece::Color::Black), Position("h8"));
 
     auto bishopMoves = MoveGenerator::generateLegalMoves(board, Position("f3"));
     
@@ -216,12 +216,12 @@ TEST_F(ComplexCasesTest, LongDiagonalBlockage) {
 
 TEST_F(ComplexCasesTest, ComplexCheckmate) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("h1"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("h2"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("g2"));
-    board->placePiece(new Queen(Piece::Color::Black), Position("f1")); 
-    board->placePiece(new Bishop(Piece::Color::Black), Position("c6")); 
-    board->placePiece(new King(Piece::Color::Black), Position("e8"));
+    board->placePiece(King(Piece::Color::White), Position("h1"));
+    board->placePiece(Pawn(Piece::Color::White), Position("h2"));
+    board->placePiece(Pawn(Piece::Color::White), Position("g2"));
+    board->placePiece(Queen(Piece::Color::Black), Position("f1")); 
+    board->placePiece(Bishop(Piece::Color::Black), Position("c6")); 
+    board->placePiece(King(Piece::Color::Black), Position("e8"));
 
     EXPECT_TRUE(board->isCheck(Piece::Color::White))
         << "Position should be check before confirming checkmate";
@@ -245,12 +245,12 @@ TEST_F(ComplexCasesTest, ComplexCheckmate) {
 
 TEST_F(ComplexCasesTest, MultiplePins) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("e4"));
-    board->placePiece(new Rook(Piece::Color::White), Position("e5")); 
-    board->placePiece(new Bishop(Piece::Color::White), Position("f4")); 
-    board->placePiece(new Queen(Piece::Color::Black), Position("e8")); 
-    board->placePiece(new Rook(Piece::Color::Black), Position("h4")); 
-    board->placePiece(new King(Piece::Color::Black), Position("h8"));
+    board->placePiece(King(Piece::Color::White), Position("e4"));
+    board->placePiece(Rook(Piece::Color::White), Position("e5")); 
+    board->placePiece(Bishop(Piece::Color::White), Position("f4")); 
+    board->placePiece(Queen(Piece::Color::Black), Position("e8")); 
+    board->placePiece(Rook(Piece::Color::Black), Position("h4")); 
+    board->placePiece(King(Piece::Color::Black), Position("h8"));
 
     auto rookMoves = MoveGenerator::generateLegalMoves(board, Position("e5"));
     for (const auto& move : rookMoves) {
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "board/Fen.hpp"
+#include <cstring>
+
+TEST(FenTest, ParsesAllFields) {
+    Board board;
+    Fen::State state;
+    ASSERT_EQ(Fen::parse("rnbqkbnr/pp1ppppp/8/2p5/4P3/8/PPPP1PPP/RNBQKBNR w Kq c6 0 2", board, state),
+              Fen::Error::None);
+
+    EXPECT_EQ(state.sideToMove, Piece::Color::White);
+    EXPECT_EQ(board.getCastlingRights(), Board::WhiteKingside | Board::BlackQueenside);
+    EXPECT_EQ(state.enPassant, Position("c6"));
+    EXPECT_EQ(board.getEnPassantPosition(), Position("c6"));
+    EXPECT_EQ(state.halfMoveClock, 0);
+    EXPECT_EQ(state.fullMoveNumber, 2);
+}
+
+TEST(FenTest, WriteRoundTrip) {
+    const char* fens[] = {
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "r3k2r/8/8/3pP3/8/8/8/R3K2R w Qk d6 7 31",
+        "8/8/8/8/8/8/8/K6k b - - 99 120"
+    };
+    for (const char* fen : fens) {
+        Board board;
+        Fen::State state;
+        ASSERT_EQ(Fen::parse(fen, board, state), Fen::Error::None) << fen;
+
+        char buffer[Fen::MAX_LENGTH];
+        EXPECT_EQ(Fen::write(board, state, buffer, sizeof(buffer)), std::strlen(fen));
+        EXPECT_STREQ(buffer, fen);
+    }
+}
+
+TEST(FenTest, WriteRejectsSmallBuffer) {
+    Board board;
+    board.initialize();
+    char buffer[10];
+    EXPECT_EQ(Fen::write(board, Fen::State(), buffer, sizeof(buffer)), 0u);
+    EXPECT_EQ(Fen::writePlacement(board, buffer, sizeof(buffer)), 0u);
+}
+
+TEST(FenTest, ReportsValidationErrors) {
+    const struct { const char* fen; Fen::Error error; } cases[] = {
+        {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP w KQkq - 0 1", Fen::Error::RankCount},
+        {"rnbqkbnr/ppppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", Fen::Error::RankLength},
+        {"rnbqkbnr/ppppxppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", Fen::Error::Placement},
+        {"8/8/8/8/8/8/8/K7 w - - 0 1", Fen::Error::KingCount},
+        {"P3k3/8/8/8/8/8/8/4K3 w - - 0 1", Fen::Error::PawnOnBackRank},
+        {"4k3/8/8/8/8/8/8/4K3 x - - 0 1", Fen::Error::SideToMove},
+        {"4k3/8/8/8/8/8/8/4K3 w K - 0 1", Fen::Error::Castling},
+        {"r3k2r/8/8/8/8/8/8/R3K2R w qK - 0 1", Fen::Error::Castling},
+        {"4k3/8/8/8/8/8/8/4K3 w - e6 0 1", Fen::Error::EnPassant},
+        {"4k3/8/8/8/8/8/8/4K3 w - - x 1", Fen::Error::HalfMoveClock},
+        {"4k3/8/8/8/8/8/8/4K3 w - - 0 0", Fen::Error::FullMoveNumber},
+        {"4k3/8/8/8/8/8/8/4K3 w - - 0 1 extra", Fen::Error::TrailingCharacters}
+    };
+    for (const auto& test : cases) {
+        Board board;
+        board.initialize();
+        Fen::State state;
+        EXPECT_EQ(Fen::parse(test.fen, board, state), test.error) << test.fen;
+        EXPECT_TRUE(board.getSquare(Position("d1"))->isOccupied()) << "board modified by " << test.fen;
+    }
+}
+
+TEST(FenTest, ClocksAreOptional) {
+    Board board;
+    Fen::State state;
+    EXPECT_EQ(Fen::parse("4k3/8/8/8/8/8/8/4K3 b - -", board, state), Fen::Error::None);
+    EXPECT_EQ(state.sideToMove, Piece::Color::Black);
+    EXPECT_EQ(state.fullMoveNumber, 1);
+}
+
+TEST(FenTest, CastlingRightsFollowMoves) {
+    Board board;
+    Fen::State state;
+    ASSERT_EQ(Fen::parse("r3k2r/8/8/8/8/8/6b1/R3K2R b KQkq - 0 1", board, state), Fen::Error::None);
+    ASSERT_TRUE(board.movePiece(Position("g2"), Position("h1")));
+    state.sideToMove = Piece::Color::White;
+
+    char buffer[Fen::MAX_LENGTH];
+    ASSERT_GT(Fen::write(board, state, buffer, sizeof(buffer)), 0u);
+    EXPECT_STREQ(buffer, "r3k2r/8/8/8/8/8/8/R3K2b w Qkq - 0 1");
+}
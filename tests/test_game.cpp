@@ -70,9 +70,9 @@ TEST_F(GameTest, PawnPromotionExplicit) {
     board->clear();
     
     std::cout << "Setting up initial position...\n";
-    board->placePiece(new Pawn(Piece::Color::White), Position("d7"));
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new King(Piece::Color::Black), Position("h8"));
+    board->placePiece(Pawn(Piece::Color::White), Position("d7"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(King(Piece::Color::Black), Position("h8"));
     std::cout << "Initial position set up completed\n";
     std::cout << "Current board state:\n" << board->toString() << "\n";
 
@@ -92,9 +92,9 @@ TEST_F(GameTest, PawnPromotionExplicit) {
     std::cout << "\nResetting position for Rook promotion test...\n";
     game->reset();
     board->clear();
-    board->placePiece(new Pawn(Piece::Color::White), Position("d7"));
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new King(Piece::Color::Black), Position("h8"));
+    board->placePiece(Pawn(Piece::Color::White), Position("d7"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(King(Piece::Color::Black), Position("h8"));
     std::cout << "Board state before Rook promotion:\n" << board->toString() << "\n";
 
     std::cout << "Testing promotion to Rook...\n";
@@ -110,9 +110,9 @@ TEST_F(GameTest, PawnPromotionExplicit) {
     std::cout << "\nResetting position for Bishop promotion test...\n";
     game->reset();
     board->clear();
-    board->placePiece(new Pawn(Piece::Color::White), Position("d7"));
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new King(Piece::Color::Black), Position("h8"));
+    board->placePiece(Pawn(Piece::Color::White), Position("d7"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(King(Piece::Color::Black), Position("h8"));
     std::cout << "Board state before Bishop promotion:\n" << board->toString() << "\n";
 
     std::cout << "Testing promotion to Bishop...\n";
@@ -128,9 +128,9 @@ TEST_F(GameTest, PawnPromotionExplicit) {
     std::cout << "\nResetting position for Knight promotion test...\n";
     game->reset();
     board->clear();
-    board->placePiece(new Pawn(Piece::Color::White), Position("d7"));
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new King(Piece::Color::Black), Position("h8"));
+    board->placePiece(Pawn(Piece::Color::White), Position("d7"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(King(Piece::Color::Black), Position("h8"));
     std::cout << "Board state before Knight promotion:\n" << board->toString() << "\n";
 
     std::cout << "Testing promotion to Knight...\n";
@@ -271,7 +271,7 @@ TEST_F(GameTest, Checkmate) {
     }
     
     auto blackPieces = board->getPieces(Piece::Color::Black);
-    for (Piece* piece : blackPieces) {
+    for (const Piece* piece : blackPieces) {
         if (piece->getType() == Piece::Type::King) continue;
         std::cout << "Checking moves for " << piece->toString() 
                  << " at " << piece->getPosition().toAlgebraic() << ":\n";
@@ -301,9 +301,9 @@ TEST_F(GameTest, Stalemate) {
     Board* board = const_cast<Board*>(game->getBoard());
     board->clear();
     
-    board->placePiece(new King(Piece::Color::Black), Position("h8"));
-    board->placePiece(new Queen(Piece::Color::White), Position("g5"));
-    board->placePiece(new King(Piece::Color::White), Position("g7"));
+    board->placePiece(King(Piece::Color::Black), Position("h8"));
+    board->placePiece(Queen(Piece::Color::White), Position("g5"));
+    board->placePiece(King(Piece::Color::White), Position("g7"));
 
     EXPECT_TRUE(game->makeMove("g5", "g6")); 
     
@@ -318,9 +318,9 @@ TEST_F(GameTest, InsufficientMaterial) {
     Board* board = const_cast<Board*>(game->getBoard());
     board->clear();
     
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new King(Piece::Color::Black), Position("e8"));
-    board->placePiece(new Bishop(Piece::Color::White), Position("c1"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(King(Piece::Color::Black), Position("e8"));
+    board->placePiece(Bishop(Piece::Color::White), Position("c1"));
     
     EXPECT_TRUE(game->makeMove("c1", "d2"));
     
@@ -364,9 +364,9 @@ TEST_F(GameTest, CastlingThroughCheck) {
     Board* board = game->getBoard();
     board->clear();
     
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Rook(Piece::Color::White), Position("h1"));
-    board->placePiece(new Rook(Piece::Color::Black), Position("e8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Rook(Piece::Color::White), Position("h1"));
+    board->placePiece(Rook(Piece::Color::Black), Position("e8"));
     
     EXPECT_FALSE(game->makeMove("e1", "g1"));
 }
@@ -376,9 +376,9 @@ TEST_F(GameTest, PromotionVariants) {
     Board* board = game->getBoard();
     board->clear();
     
-    board->placePiece(new Pawn(Piece::Color::White), Position("e7"));
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new King(Piece::Color::Black), Position("a8"));
+    board->placePiece(Pawn(Piece::Color::White), Position("e7"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(King(Piece::Color::Black), Position("a8"));
     
     EXPECT_TRUE(game->makeMove("e7", "e8q")); 
     game->undoLastMove();
@@ -78,6 +78,44 @@ TEST_F(GameStateTest, UndoMove) {
     EXPECT_EQ(gameState->getMoveCount(), 1);
 }
 
+TEST_F(GameStateTest, UndoRestoresCaptureAndCastling) {
+    board->clear();
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Rook(Piece::Color::White), Position("h1"));
+    board->placePiece(King(Piece::Color::Black), Position("e8"));
+    board->placePiece(Bishop(Piece::Color::Black), Position("b4"));
+    board->placePiece(Pawn(Piece::Color::White), Position("d2"));
+    const std::string initialFen = board->toFEN();
+
+    EXPECT_TRUE(gameState->makeMove(Move(Position("e1"), Position("g1"), Move::Type::Castling), board));
+    EXPECT_TRUE(gameState->makeMove(Move(Position("b4"), Position("d2"), Move::Type::Capture), board));
+
+    gameState->undoLastMove(board);
+    gameState->undoLastMove(board);
+
+    EXPECT_EQ(board->toFEN(), initialFen);
+    EXPECT_FALSE(board->getSquare(Position("e1"))->getPiece()->hasMoved());
+    EXPECT_FALSE(board->getSquare(Position("h1"))->getPiece()->hasMoved());
+    EXPECT_EQ(gameState->getHalfMoveCount(), 0);
+    EXPECT_TRUE(gameState->getMoveHistory().empty());
+}
+
+TEST_F(GameStateTest, UndoRestoresEnPassantCapture) {
+    board->initialize();
+    gameState->makeMove(Move(Position("e2"), Position("e4"), Move::Type::DoublePawn), board);
+    gameState->makeMove(Move(Position("a7"), Position("a6")), board);
+    gameState->makeMove(Move(Position("e4"), Position("e5")), board);
+    gameState->makeMove(Move(Position("d7"), Position("d5"), Move::Type::DoublePawn), board);
+    const std::string fenBefore = board->toFEN();
+
+    EXPECT_TRUE(gameState->makeMove(Move(Position("e5"), Position("d6"), Move::Type::EnPassant), board));
+    EXPECT_FALSE(board->getSquare(Position("d5"))->isOccupied());
+
+    gameState->undoLastMove(board);
+    EXPECT_EQ(board->toFEN(), fenBefore);
+    EXPECT_EQ(board->getEnPassantPosition(), Position("d6"));
+}
+
 TEST_F(GameStateTest, DrawOffer) {
     gameState->offerDraw(Piece::Color::White);
     
@@ -124,8 +162,8 @@ TEST_F(GameStateTest, GameReset) {
 
 TEST_F(GameStateTest, EnPassantMove) {
     board->clear();
-    board->placePiece(new Pawn(Piece::Color::White), Position("e5"));
-    board->placePiece(new Pawn(Piece::Color::Black), Position("f5"));
+    board->placePiece(Pawn(Piece::Color::White), Position("e5"));
+    board->placePiece(Pawn(Piece::Color::Black), Position("f5"));
     board->setEnPassantPosition(Position("f6"));
     
     Move enPassant(Position("e5"), Position("f6"), Move::Type::EnPassant);
@@ -134,7 +172,7 @@ TEST_F(GameStateTest, EnPassantMove) {
 
 TEST_F(GameStateTest, PawnPromotion) {
     board->clear();
-    board->placePiece(new Pawn(Piece::Color::White), Position("e7"));
+    board->placePiece(Pawn(Piece::Color::White), Position("e7"));
     
     Move promotion(Position("e7"), Position("e8"), Move::Type::Promotion, Piece::Type::Queen);
     EXPECT_TRUE(gameState->makeMove(promotion, board));
@@ -142,8 +180,8 @@ TEST_F(GameStateTest, PawnPromotion) {
 
 TEST_F(GameStateTest, CheckState) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Queen(Piece::Color::Black), Position("e8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Queen(Piece::Color::Black), Position("e8"));
     
     Move checkMove(Position("e8"), Position("e2"));
     gameState->makeMove(checkMove, board);
@@ -152,9 +190,9 @@ TEST_F(GameStateTest, CheckState) {
 
 TEST_F(GameStateTest, PinnedPieceMove) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Rook(Piece::Color::White), Position("e2"));
-    board->placePiece(new Queen(Piece::Color::Black), Position("e8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Rook(Piece::Color::White), Position("e2"));
+    board->placePiece(Queen(Piece::Color::Black), Position("e8"));
     
     Move illegalMove(Position("e2"), Position("f2"));
     EXPECT_FALSE(gameState->makeMove(illegalMove, board));
@@ -186,9 +224,9 @@ TEST_F(GameStateTest, MultipleMoveSequence) {
 }
 TEST_F(GameStateTest, InsufficientMaterialDraw) {
     board->clear();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new King(Piece::Color::Black), Position("e8"));
-    board->placePiece(new Bishop(Piece::Color::White), Position("c1"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(King(Piece::Color::Black), Position("e8"));
+    board->placePiece(Bishop(Piece::Color::White), Position("c1"));
     
     Move move(Position("c1"), Position("d2"));
     gameState->makeMove(move, board);
@@ -211,9 +249,9 @@ TEST_F(GameStateTest, MoveWrongColorPiece) {
 
 TEST_F(GameStateTest, RepeatedPosition) {
     board->clear();
-    King* whiteKing = new King(Piece::Color::White);
-    King* blackKing = new King(Piece::Color::Black);
-    Rook* whiteRook = new Rook(Piece::Color::White);
+    King whiteKing(Piece::Color::White);
+    King blackKing(Piece::Color::Black);
+    Rook whiteRook(Piece::Color::White);
     
     board->placePiece(whiteKing, Position("e1"));
     board->placePiece(blackKing, Position("e8"));
@@ -232,12 +270,29 @@ TEST_F(GameStateTest, RepeatedPosition) {
     EXPECT_TRUE(gameState->isThreefoldRepetition());
 }
 
+TEST_F(GameStateTest, PlacementRepeatedWithOtherSideToMoveIsNotRepetition) {
+    board->clear();
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(King(Piece::Color::Black), Position("e8"));
+    board->placePiece(Rook(Piece::Color::White), Position("a1"));
+
+    const char* whiteCycle[] = {"a1", "a2", "a3", "a1"};
+    const char* blackCycle[] = {"e8", "e7", "e8", "e7"};
+    for (int i = 0; i < 3; i++) {
+        EXPECT_TRUE(gameState->makeMove(Move(Position(whiteCycle[i]), Position(whiteCycle[i + 1])), board));
+        EXPECT_TRUE(gameState->makeMove(Move(Position(blackCycle[i]), Position(blackCycle[i + 1])), board));
+    }
+
+    EXPECT_FALSE(gameState->isThreefoldRepetition());
+    EXPECT_EQ(gameState->getPositionKeys().size(), 7u);
+}
+
 TEST_F(GameStateTest, FiftyMovesRule) {
     board->clear();
     
-    King* whiteKing = new King(Piece::Color::White);
-    King* blackKing = new King(Piece::Color::Black);
-    Rook* whiteRook = new Rook(Piece::Color::White);
+    King whiteKing(Piece::Color::White);
+    King blackKing(Piece::Color::Black);
+    Rook whiteRook(Piece::Color::White);
     
     board->placePiece(whiteKing, Position("e1"));
     board->placePiece(blackKing, Position("e8"));
@@ -277,11 +332,11 @@ TEST_F(GameStateTest, FiftyMovesRule) {
 TEST_F(GameStateTest, CastlingMove) {
     board->clear();
     
-    King* king = new King(Piece::Color::White);
-    Rook* rook = new Rook(Piece::Color::White);
+    King king(Piece::Color::White);
+    Rook rook(Piece::Color::White);
     
-    king->setMoved(false);
-    rook->setMoved(false);
+    king.setMoved(false);
+    rook.setMoved(false);
     
     EXPECT_TRUE(board->placePiece(king, Position("e1")));
     EXPECT_TRUE(board->placePiece(rook, Position("h1")));
@@ -307,14 +362,25 @@ TEST_F(GameStateTest, CastlingMove) {
         << "Rook should be on f1";
 }
 
+TEST_F(GameStateTest, CastlingNeedsBoardCastlingRight) {
+    Piece::Color side;
+    ASSERT_TRUE(board->setupFromFEN("4k3/8/8/8/8/8/8/R3K2R w - - 0 1", side));
+    EXPECT_FALSE(gameState->makeMove(Move(Position("e1"), Position("g1"), Move::Type::Castling), board));
+    EXPECT_FALSE(gameState->makeMove(Move(Position("e1"), Position("c1"), Move::Type::Castling), board));
+
+    ASSERT_TRUE(board->setupFromFEN("4k3/8/8/8/8/8/8/R3K2R w Q - 0 1", side));
+    EXPECT_FALSE(gameState->makeMove(Move(Position("e1"), Position("g1"), Move::Type::Castling), board));
+    EXPECT_TRUE(gameState->makeMove(Move(Position("e1"), Position("c1"), Move::Type::Castling), board));
+}
+
 TEST_F(GameStateTest, QueensideCastlingMove) {
     board->clear();
     
-    King* king = new King(Piece::Color::White);
-    Rook* rook = new Rook(Piece::Color::White);
+    King king(Piece::Color::White);
+    Rook rook(Piece::Color::White);
     
-    king->setMoved(false);
-    rook->setMoved(false);
+    king.setMoved(false);
+    rook.setMoved(false);
     
     EXPECT_TRUE(board->placePiece(king, Position("e1")));
     EXPECT_TRUE(board->placePiece(rook, Position("a1")));
@@ -32,7 +32,7 @@ protected:
 
 TEST_F(MoveGeneratorTest, PawnInitialMoves) {
     Position pawnPos(1, 1); 
-    board->placePiece(new Pawn(Piece::Color::White), pawnPos);
+    board->placePiece(Pawn(Piece::Color::White), pawnPos);
     
     auto moves = MoveGenerator::generateLegalMoves(board, pawnPos);
     
@@ -46,9 +46,9 @@ TEST_F(MoveGeneratorTest, PawnCapture) {
     Position blackPawn1Pos(2, 4); 
     Position blackPawn2Pos(4, 4); 
     
-    board->placePiece(new Pawn(Piece::Color::White), whitePawnPos);
-    board->placePiece(new Pawn(Piece::Color::Black), blackPawn1Pos);
-    board->placePiece(new Pawn(Piece::Color::Black), blackPawn2Pos);
+    board->placePiece(Pawn(Piece::Color::White), whitePawnPos);
+    board->placePiece(Pawn(Piece::Color::Black), blackPawn1Pos);
+    board->placePiece(Pawn(Piece::Color::Black), blackPawn2Pos);
     
     auto moves = MoveGenerator::generateLegalMoves(board, whitePawnPos);
     
@@ -62,8 +62,8 @@ TEST_F(MoveGeneratorTest, EnPassant) {
     Position whitePawnPos(3, 4); 
     Position blackPawnPos(4, 4); 
     
-    board->placePiece(new Pawn(Piece::Color::White), whitePawnPos);
-    board->placePiece(new Pawn(Piece::Color::Black), blackPawnPos);
+    board->placePiece(Pawn(Piece::Color::White), whitePawnPos);
+    board->placePiece(Pawn(Piece::Color::Black), blackPawnPos);
     board->setEnPassantPosition(Position(4, 5)); 
     
     auto moves = MoveGenerator::generateLegalMoves(board, whitePawnPos);
@@ -76,7 +76,7 @@ TEST_F(MoveGeneratorTest, EnPassant) {
 
 TEST_F(MoveGeneratorTest, KnightMoves) {
     Position knightPos(3, 3); 
-    board->placePiece(new Knight(Piece::Color::White), knightPos);
+    board->placePiece(Knight(Piece::Color::White), knightPos);
     
     auto moves = MoveGenerator::generateLegalMoves(board, knightPos);
     
@@ -100,7 +100,7 @@ TEST_F(MoveGeneratorTest, KnightMoves) {
 
 TEST_F(MoveGeneratorTest, BishopMoves) {
     Position bishopPos(3, 3); 
-    board->placePiece(new Bishop(Piece::Color::White), bishopPos);
+    board->placePiece(Bishop(Piece::Color::White), bishopPos);
     
     auto moves = MoveGenerator::generateLegalMoves(board, bishopPos);
     
@@ -109,7 +109,7 @@ TEST_F(MoveGeneratorTest, BishopMoves) {
 
 TEST_F(MoveGeneratorTest, RookMoves) {
     Position rookPos(3, 3); 
-    board->placePiece(new Rook(Piece::Color::White), rookPos);
+    board->placePiece(Rook(Piece::Color::White), rookPos);
     
     auto moves = MoveGenerator::generateLegalMoves(board, rookPos);
     
@@ -118,7 +118,7 @@ TEST_F(MoveGeneratorTest, RookMoves) {
 
 TEST_F(MoveGeneratorTest, QueenMoves) {
     Position queenPos(3, 3); 
-    board->placePiece(new Queen(Piece::Color::White), queenPos);
+    board->placePiece(Queen(Piece::Color::White), queenPos);
     
     auto moves = MoveGenerator::generateLegalMoves(board, queenPos);
     
@@ -130,14 +130,14 @@ TEST_F(MoveGeneratorTest, Castling) {
     Position kingsideRookPos(7, 0);
     Position queensideRookPos(0, 0);
     
-    King* king = new King(Piece::Color::White);
-    king->setMoved(false);
+    King king(Piece::Color::White);
+    king.setMoved(false);
     
-    Rook* kingsideRook = new Rook(Piece::Color::White);
-    kingsideRook->setMoved(false);
+    Rook kingsideRook(Piece::Color::White);
+    kingsideRook.setMoved(false);
     
-    Rook* queensideRook = new Rook(Piece::Color::White);
-    queensideRook->setMoved(false);
+    Rook queensideRook(Piece::Color::White);
+    queensideRook.setMoved(false);
     
     ASSERT_TRUE(board->placePiece(king, kingPos));
     ASSERT_TRUE(board->placePiece(kingsideRook, kingsideRookPos));
@@ -154,9 +154,9 @@ TEST_F(MoveGeneratorTest, BlockedCastling) {
     Position kingPos(4, 0); 
     Position rookPos(7, 0); 
     Position blockingPos(6, 0); 
-    board->placePiece(new King(Piece::Color::White), kingPos);
-    board->placePiece(new Rook(Piece::Color::White), rookPos);
-    board->placePiece(new Bishop(Piece::Color::White), blockingPos);
+    board->placePiece(King(Piece::Color::White), kingPos);
+    board->placePiece(Rook(Piece::Color::White), rookPos);
+    board->placePiece(Bishop(Piece::Color::White), blockingPos);
     
     auto castlingMoves = MoveGenerator::getCastlingMoves(board, Piece::Color::White);
     
@@ -168,9 +168,9 @@ TEST_F(MoveGeneratorTest, CastlingUnderCheck) {
     Position rookPos(7, 0); 
     Position enemyQueenPos(4, 7); 
     
-    board->placePiece(new King(Piece::Color::White), kingPos);
-    board->placePiece(new Rook(Piece::Color::White), rookPos);
-    board->placePiece(new Queen(Piece::Color::Black), enemyQueenPos);
+    board->placePiece(King(Piece::Color::White), kingPos);
+    board->placePiece(Rook(Piece::Color::White), rookPos);
+    board->placePiece(Queen(Piece::Color::Black), enemyQueenPos);
     
     auto castlingMoves = MoveGenerator::getCastlingMoves(board, Piece::Color::White);
     
@@ -179,7 +179,7 @@ TEST_F(MoveGeneratorTest, CastlingUnderCheck) {
 
 TEST_F(MoveGeneratorTest, PawnPromotion) {
     Position whitePawnPos(1, 6); 
-    board->placePiece(new Pawn(Piece::Color::White), whitePawnPos);
+    board->placePiece(Pawn(Piece::Color::White), whitePawnPos);
     
     auto moves = MoveGenerator::generateLegalMoves(board, whitePawnPos);
     
@@ -192,8 +192,8 @@ TEST_F(MoveGeneratorTest, PawnPromotion) {
 TEST_F(MoveGeneratorTest, CheckEvasion) {
     Position whiteKingPos(4, 0);
     Position blackQueenPos(4, 7); 
-    board->placePiece(new King(Piece::Color::White), whiteKingPos);
-    board->placePiece(new Queen(Piece::Color::Black), blackQueenPos);
+    board->placePiece(King(Piece::Color::White), whiteKingPos);
+    board->placePiece(Queen(Piece::Color::Black), blackQueenPos);
     
     auto moves = MoveGenerator::generateLegalMoves(board, whiteKingPos);
     
@@ -204,3 +204,37 @@ TEST_F(MoveGeneratorTest, CheckEvasion) {
     }
 }
 
+
+TEST_F(MoveGeneratorTest, CastlingRightsFollowKingAndRookMoves) {
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Rook(Piece::Color::White), Position("a1"));
+    board->placePiece(Rook(Piece::Color::White), Position("h1"));
+    board->placePiece(King(Piece::Color::Black), Position("e8"));
+    board->placePiece(Rook(Piece::Color::Black), Position("h8"));
+    EXPECT_EQ(board->getCastlingRights(), Board::AllCastlingRights);
+
+    const std::uint64_t hashBefore = board->getHash();
+    ASSERT_TRUE(board->movePiece(Position("h1"), Position("h8")));
+    EXPECT_FALSE(board->hasCastlingRight(Board::WhiteKingside));
+    EXPECT_FALSE(board->hasCastlingRight(Board::BlackKingside));
+    EXPECT_TRUE(board->hasCastlingRight(Board::WhiteQueenside));
+    EXPECT_NE(board->getHash(), hashBefore);
+
+    auto castlingMoves = MoveGenerator::getCastlingMoves(board, Piece::Color::White);
+    EXPECT_EQ(castlingMoves.size(), 1u);
+    EXPECT_TRUE(containsMove(castlingMoves, Position("e1"), Position("c1")));
+
+    ASSERT_TRUE(board->movePiece(Position("e1"), Position("e2")));
+    ASSERT_TRUE(board->movePiece(Position("e2"), Position("e1")));
+    EXPECT_TRUE(MoveGenerator::getCastlingMoves(board, Piece::Color::White).empty());
+}
+
+TEST_F(MoveGeneratorTest, RejectedCastleKeepsCastlingRights) {
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(King(Piece::Color::Black), Position("e8"));
+    const std::uint64_t hashBefore = board->getHash();
+
+    EXPECT_FALSE(board->movePiece(Position("e1"), Position("g1")));
+    EXPECT_EQ(board->getCastlingRights(), Board::AllCastlingRights);
+    EXPECT_EQ(board->getHash(), hashBefore);
+}
@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+#include "utils/Pgn.hpp"
+#include "moves/Notation.hpp"
+#include "analysis/PgnIngester.hpp"
+#include "utils/BinaryGame.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace {
+Board boardFromFen(const std::string& fen, Piece::Color& side) {
+    Board board;
+    board.setupFromFEN(fen, side);
+    return board;
+}
+}
+
+TEST(NotationTest, SanDisambiguationAndCastling) {
+    Piece::Color side;
+    Board board = boardFromFen("4k3/8/8/8/8/8/4K3/R6R w - - 0 1", side);
+
+    Move move;
+    ASSERT_TRUE(Notation::parseSan(board, side, "Rad1", move));
+    EXPECT_EQ(move.getFrom(), Position("a1"));
+    EXPECT_EQ(Notation::toSan(board, side, move), "Rad1");
+    EXPECT_FALSE(Notation::parseSan(board, side, "Rd1", move));
+
+    board = boardFromFen("4k3/8/8/8/8/8/8/R3K2R w KQ - 0 1", side);
+    ASSERT_TRUE(Notation::parseSan(board, side, "O-O", move));
+    EXPECT_EQ(move.getTo(), Position("g1"));
+    EXPECT_EQ(Notation::toSan(board, side, move), "O-O");
+}
+
+TEST(NotationTest, SanPromotionWithCheck) {
+    Piece::Color side;
+    Board board = boardFromFen("4k3/1P6/8/8/8/8/8/4K3 w - - 0 1", side);
+
+    Move move;
+    ASSERT_TRUE(Notation::parseSan(board, side, "b8=Q+", move));
+    EXPECT_EQ(move.getPromotionPiece(), Piece::Type::Queen);
+    EXPECT_EQ(Notation::toSan(board, side, move), "b8=Q+");
+    EXPECT_FALSE(Notation::parseSan(board, side, "b8", move));
+}
+
+TEST(NotationTest, SanIgnoresPinnedPieceWhenDisambiguating) {
+    Piece::Color side;
+    Board board = boardFromFen("4k3/8/8/b7/8/2N3N1/8/4K3 w - - 0 1", side);
+
+    // Both knights reach e4, but the one on c3 is pinned, so "Ne4" is not ambiguous.
+    Move move;
+    ASSERT_TRUE(Notation::parseSan(board, side, "Ne4", move));
+    EXPECT_EQ(move.getFrom(), Position("g3"));
+    EXPECT_FALSE(Notation::parseSan(board, side, "Nce4", move));
+}
+
+TEST(PgnTest, ReadsMultipleGamesSkippingCommentsAndVariations) {
+    std::istringstream input(
+        "[Event \"First\"]\n"
+        "[Result \"1-0\"]\n"
+        "\n"
+        "1. e4 {best by test} e5 (1... c5 2. Nf3 (2. c3) d6) 2. Nf3 $1 Nc6\n"
+        "3. Bb5 ; Ruy Lopez\n"
+        "a6 1-0\n"
+        "\n"
+        "[Event \"Second\"]\n"
+        "\n"
+        "1.d4 d5 2.c4 *\n");
+    PgnReader reader(input);
+    PgnGame game;
+
+    ASSERT_TRUE(reader.readGame(game));
+    EXPECT_EQ(game.getTag("Event"), "First");
+    EXPECT_EQ(game.result, "1-0");
+    EXPECT_TRUE(game.error.empty()) << game.error;
+    ASSERT_EQ(game.moves.size(), 6u);
+    EXPECT_EQ(game.moves[4].getTo(), Position("b5"));
+
+    ASSERT_TRUE(reader.readGame(game));
+    EXPECT_EQ(game.getTag("Event"), "Second");
+    EXPECT_EQ(game.moves.size(), 3u);
+    EXPECT_EQ(game.result, "*");
+
+    EXPECT_FALSE(reader.readGame(game));
+}
+
+TEST(PgnTest, ReportsIllegalMove) {
+    std::istringstream input("1. e4 e5 2. Ke3 Nc6 *\n");
+    PgnReader reader(input);
+    PgnGame game;
+
+    ASSERT_TRUE(reader.readGame(game));
+    EXPECT_FALSE(game.error.empty());
+    EXPECT_EQ(game.moves.size(), 2u);
+}
+
+TEST(PgnTest, ReadsZeroStyleCastling) {
+    std::istringstream input(
+        "1. e4 e5 2. Nf3 Nc6 3. Bc4 Bc5 4. 0-0 d6 5.d3 Be6 6. Nc3 Qd7 7. Be3 0-0-0 *\n");
+    PgnReader reader(input);
+    PgnGame game;
+    ASSERT_TRUE(reader.readGame(game));
+    ASSERT_TRUE(game.error.empty()) << game.error;
+    ASSERT_EQ(game.moves.size(), 14u);
+    EXPECT_EQ(game.moves[6].getType(), Move::Type::Castling);
+    EXPECT_EQ(game.moves[13].getType(), Move::Type::Castling);
+}
+
+TEST(PgnTest, WriterRoundTrip) {
+    std::istringstream input(
+        "[Event \"Round trip\"]\n"
+        "[FEN \"4k3/1P6/8/8/8/8/8/4K3 b - - 0 12\"]\n"
+        "\n"
+        "12... Kd7 13. b8=N+ Kc7 1/2-1/2\n");
+    PgnReader reader(input);
+    PgnGame game;
+    ASSERT_TRUE(reader.readGame(game));
+    ASSERT_TRUE(game.error.empty()) << game.error;
+
+    std::ostringstream output;
+    PgnWriter writer(output);
+    ASSERT_TRUE(writer.writeGame(game));
+
+    EXPECT_NE(output.str().find("12... Kd7 13. b8=N+ Kc7 1/2-1/2"), std::string::npos);
+    EXPECT_NE(output.str().find("[Event \"Round trip\"]"), std::string::npos);
+}
+
+TEST(PgnTest, IngestSplitsAtGameBoundaries) {
+    std::string archive;
+    for (int i = 0; i < 8; ++i) {
+        archive += "[Event \"Game " + std::to_string(i) + "\"]\n";
+        archive += i % 2 ? "[ECO \"C20\"]\n\n1. e4 e5 1-0\n\n" : "\n1. d4 d5 2. c4 1/2-1/2\n\n";
+    }
+    archive += "[Event \"Broken\"]\n\n1. e5 0-1\n";
+
+    const auto bounds = PgnIngester::splitAtGames(archive.data(), archive.size(), 4);
+    ASSERT_GE(bounds.size(), 3u);
+    for (std::size_t i = 1; i + 1 < bounds.size(); ++i) {
+        EXPECT_EQ(archive.compare(bounds[i], 7, "[Event "), 0);
+    }
+
+    PgnIngester ingester(4);
+    const IngestStats stats = ingester.ingest(archive.data(), archive.size());
+    EXPECT_EQ(stats.games, 9u);
+    EXPECT_EQ(stats.rejected, 1u);
+    EXPECT_EQ(stats.whiteWins, 4u);
+    EXPECT_EQ(stats.draws, 4u);
+    EXPECT_EQ(stats.plies, 4u * 2 + 4u * 3);
+    EXPECT_EQ(stats.openings.at("C20"), 4u);
+    EXPECT_EQ(stats.openings.at("d2d4 d7d5"), 4u);
+}
+
+TEST(BinaryGameTest, MoveEncodingRoundTrip) {
+    const Move promotion(Position("b7"), Position("a8"), Move::Type::Promotion, Piece::Type::Knight);
+    const Move decoded = BinaryGame::decodeMove(BinaryGame::encodeMove(promotion));
+
+    EXPECT_EQ(decoded, promotion);
+    EXPECT_EQ(decoded.getPromotionPiece(), Piece::Type::Knight);
+    EXPECT_EQ(BinaryGame::decodeMove(BinaryGame::encodeMove(Move(Position("h8"), Position("a1")))).getTo(),
+              Position("a1"));
+}
+
+TEST(BinaryGameTest, WriteIndexAndSeek) {
+    const std::string path = ::testing::TempDir() + "games.cgb";
+    std::istringstream input(
+        "[Event \"A\"]\n\n1. e4 e5 2. Nf3 1-0\n\n"
+        "[Event \"B\"]\n[FEN \"4k3/1P6/8/8/8/8/8/4K3 w - - 0 1\"]\n\n1. b8=Q+ Kd7 *\n");
+    PgnReader pgn(input);
+    {
+        BinaryGameWriter writer(path);
+        ASSERT_TRUE(writer.isOpen());
+        PgnGame game;
+        while (pgn.readGame(game)) {
+            ASSERT_TRUE(writer.writeGame(game));
+        }
+    }
+
+    BinaryGameReader reader(path);
+    ASSERT_TRUE(reader.isOpen());
+    ASSERT_EQ(reader.getGameCount(), 2u);
+
+    PgnGame game;
+    ASSERT_TRUE(reader.readGame(1, game));
+    EXPECT_EQ(game.getTag("Event"), "B");
+    EXPECT_EQ(game.result, "*");
+    ASSERT_EQ(game.moves.size(), 2u);
+
+    Board board;
+    Piece::Color side;
+    ASSERT_TRUE(reader.positionAt(1, 1, board, side));
+    EXPECT_EQ(side, Piece::Color::Black);
+    EXPECT_EQ(board.getSquare(Position("b8"))->getPiece()->getType(), Piece::Type::Queen);
+
+    ASSERT_TRUE(reader.readGame(0, game));
+    EXPECT_EQ(game.result, "1-0");
+    EXPECT_EQ(game.moves.size(), 3u);
+    EXPECT_FALSE(reader.readGame(2, game));
+
+    // An index whose count promises more entries than the file holds is rejected.
+    {
+        std::fstream index(path + ".idx", std::ios::binary | std::ios::in | std::ios::out);
+        index.seekp(4);
+        const char hugeCount[8] = {0, 0, 0, 0, 0, 0, 0, 0x10};
+        index.write(hugeCount, sizeof(hugeCount));
+    }
+    EXPECT_FALSE(BinaryGameReader(path).isOpen());
+
+    std::remove(path.c_str());
+    std::remove((path + ".idx").c_str());
+}
@@ -67,7 +67,7 @@ protected:
 
 TEST_F(PiecesTest, QueenBasicMoves) {
     Position queenPos("d4");
-    board->placePiece(new Queen(Piece::Color::White), queenPos);
+    board->placePiece(Queen(Piece::Color::White), queenPos);
     
     auto moves = board->getSquare(queenPos)->getPiece()->getPossibleMoves(board);
     
@@ -86,10 +86,10 @@ TEST_F(PiecesTest, QueenBasicMoves) {
 }
 
 TEST_F(PiecesTest, QueenCaptures) {
-    board->placePiece(new Queen(Piece::Color::White), Position("d4"));
-    board->placePiece(new Pawn(Piece::Color::Black), Position("d7")); 
-    board->placePiece(new Pawn(Piece::Color::White), Position("d2")); 
-    board->placePiece(new Pawn(Piece::Color::Black), Position("g7")); 
+    board->placePiece(Queen(Piece::Color::White), Position("d4"));
+    board->placePiece(Pawn(Piece::Color::Black), Position("d7")); 
+    board->placePiece(Pawn(Piece::Color::White), Position("d2")); 
+    board->placePiece(Pawn(Piece::Color::Black), Position("g7")); 
     
     auto moves = board->getSquare(Position("d4"))->getPiece()->getPossibleMoves(board);
     
@@ -100,9 +100,9 @@ TEST_F(PiecesTest, QueenCaptures) {
 }
 
 TEST_F(PiecesTest, QueenBlocked) {
-    board->placePiece(new Queen(Piece::Color::White), Position("d4"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("d5")); 
-    board->placePiece(new Pawn(Piece::Color::White), Position("e4")); 
+    board->placePiece(Queen(Piece::Color::White), Position("d4"));
+    board->placePiece(Pawn(Piece::Color::White), Position("d5")); 
+    board->placePiece(Pawn(Piece::Color::White), Position("e4")); 
     
     auto moves = board->getSquare(Position("d4"))->getPiece()->getPossibleMoves(board);
     
@@ -117,7 +117,7 @@ TEST_F(PiecesTest, QueenBlocked) {
 TEST_F(PiecesTest, KingBasicMoves) {
     clearBoard();
     Position kingPos("e4");
-    board->placePiece(new King(Piece::Color::White), kingPos);
+    board->placePiece(King(Piece::Color::White), kingPos);
     
     auto moves = board->getSquare(kingPos)->getPiece()->getPossibleMoves(board);
     
@@ -135,9 +135,9 @@ TEST_F(PiecesTest, KingBasicMoves) {
 
 TEST_F(PiecesTest, KingCastling) {
     clearBoard();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Rook(Piece::Color::White), Position("h1"));
-    board->placePiece(new Rook(Piece::Color::White), Position("a1"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Rook(Piece::Color::White), Position("h1"));
+    board->placePiece(Rook(Piece::Color::White), Position("a1"));
     
     King* king = static_cast<King*>(board->getSquare(Position("e1"))->getPiece());
     auto moves = king->getPossibleMoves(board);
@@ -153,19 +153,19 @@ TEST_F(PiecesTest, KingCastling) {
 
 TEST_F(PiecesTest, KingInCheck) {
     clearBoard();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Rook(Piece::Color::Black), Position("e8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Rook(Piece::Color::Black), Position("e8"));
     
     EXPECT_TRUE(isKingInCheck(Piece::Color::White));
     
-    board->placePiece(new Bishop(Piece::Color::White), Position("e4"));
+    board->placePiece(Bishop(Piece::Color::White), Position("e4"));
     EXPECT_FALSE(isKingInCheck(Piece::Color::White));
 }
 
 TEST_F(PiecesTest, KnightBasicMoves) {
     clearBoard();
     Position knightPos("d4");
-    board->placePiece(new Knight(Piece::Color::White), knightPos);
+    board->placePiece(Knight(Piece::Color::White), knightPos);
     
     auto moves = board->getSquare(knightPos)->getPiece()->getPossibleMoves(board);
     
@@ -183,11 +183,11 @@ TEST_F(PiecesTest, KnightBasicMoves) {
 
 TEST_F(PiecesTest, KnightJumping) {
     clearBoard();
-    board->placePiece(new Knight(Piece::Color::White), Position("d4"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("d3"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("d5"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("c4"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("e4"));
+    board->placePiece(Knight(Piece::Color::White), Position("d4"));
+    board->placePiece(Pawn(Piece::Color::White), Position("d3"));
+    board->placePiece(Pawn(Piece::Color::White), Position("d5"));
+    board->placePiece(Pawn(Piece::Color::White), Position("c4"));
+    board->placePiece(Pawn(Piece::Color::White), Position("e4"));
     
     auto moves = board->getSquare(Position("d4"))->getPiece()->getPossibleMoves(board);
     
@@ -196,7 +196,7 @@ TEST_F(PiecesTest, KnightJumping) {
 
 TEST_F(PiecesTest, KnightEdgeCases) {
     clearBoard();
-    board->placePiece(new Knight(Piece::Color::White), Position("a1"));
+    board->placePiece(Knight(Piece::Color::White), Position("a1"));
     
     auto moves = board->getSquare(Position("a1"))->getPiece()->getPossibleMoves(board);
     
@@ -208,7 +208,7 @@ TEST_F(PiecesTest, KnightEdgeCases) {
 TEST_F(PiecesTest, BishopBasicMoves) {
     clearBoard();
     Position bishopPos("d4");
-    board->placePiece(new Bishop(Piece::Color::White), bishopPos);
+    board->placePiece(Bishop(Piece::Color::White), bishopPos);
     
     auto moves = board->getSquare(bishopPos)->getPiece()->getPossibleMoves(board);
     
@@ -223,9 +223,9 @@ TEST_F(PiecesTest, BishopBasicMoves) {
 
 TEST_F(PiecesTest, BishopBlocked) {
     clearBoard();
-    board->placePiece(new Bishop(Piece::Color::White), Position("d4"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("c5"));
-    board->placePiece(new Pawn(Piece::Color::Black), Position("e5"));
+    board->placePiece(Bishop(Piece::Color::White), Position("d4"));
+    board->placePiece(Pawn(Piece::Color::White), Position("c5"));
+    board->placePiece(Pawn(Piece::Color::Black), Position("e5"));
     
     auto moves = board->getSquare(Position("d4"))->getPiece()->getPossibleMoves(board);
     
@@ -238,10 +238,10 @@ TEST_F(PiecesTest, BishopBlocked) {
 
 TEST_F(PiecesTest, BishopCaptures) {
     clearBoard();
-    board->placePiece(new Bishop(Piece::Color::White), Position("d4"));
-    board->placePiece(new Pawn(Piece::Color::Black), Position("f6"));
-    board->placePiece(new Pawn(Piece::Color::Black), Position("b2"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("f2"));
+    board->placePiece(Bishop(Piece::Color::White), Position("d4"));
+    board->placePiece(Pawn(Piece::Color::Black), Position("f6"));
+    board->placePiece(Pawn(Piece::Color::Black), Position("b2"));
+    board->placePiece(Pawn(Piece::Color::White), Position("f2"));
     
     auto moves = board->getSquare(Position("d4"))->getPiece()->getPossibleMoves(board);
     
@@ -255,9 +255,9 @@ TEST_F(PiecesTest, BishopCaptures) {
 TEST_F(PiecesTest, PiecesInteraction) {
     clearBoard();
     
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("e2"));
-    board->placePiece(new Queen(Piece::Color::Black), Position("e8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Pawn(Piece::Color::White), Position("e2"));
+    board->placePiece(Queen(Piece::Color::Black), Position("e8"));
     
     auto pawnMoves = board->getSquare(Position("e2"))->getPiece()->getPossibleMoves(board);
     
@@ -279,9 +279,9 @@ TEST_F(PiecesTest, PiecesInteraction) {
 
 TEST_F(PiecesTest, PinnedPieces) {
     clearBoard();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("e2"));
-    board->placePiece(new Rook(Piece::Color::Black), Position("e8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Pawn(Piece::Color::White), Position("e2"));
+    board->placePiece(Rook(Piece::Color::Black), Position("e8"));
     
     auto pawnMoves = board->getSquare(Position("e2"))->getPiece()->getPossibleMoves(board);
 
@@ -294,9 +294,9 @@ TEST_F(PiecesTest, PinnedPieces) {
         << "Pinned pawn should move two squares forward on first move";
 
     clearBoard();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Rook(Piece::Color::White), Position("d1"));
-    board->placePiece(new Queen(Piece::Color::Black), Position("h1"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Rook(Piece::Color::White), Position("d1"));
+    board->placePiece(Queen(Piece::Color::Black), Position("h1"));
     
     auto rookMoves = board->getSquare(Position("d1"))->getPiece()->getPossibleMoves(board);
     
@@ -312,7 +312,7 @@ TEST_F(PiecesTest, PinnedPieces) {
 
 TEST_F(PiecesTest, AttackingLines) {
     clearBoard();
-    board->placePiece(new Rook(Piece::Color::White), Position("a1"));
+    board->placePiece(Rook(Piece::Color::White), Position("a1"));
     
     for (int x = 1; x < 8; x++) {
         EXPECT_TRUE(board->isPositionAttacked(Position(x, 0), Piece::Color::White));
@@ -321,8 +321,8 @@ TEST_F(PiecesTest, AttackingLines) {
 
 TEST_F(PiecesTest, KingCheckEvasion) {
     clearBoard();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Rook(Piece::Color::Black), Position("e8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Rook(Piece::Color::Black), Position("e8"));
     
     auto kingMoves = board->getSquare(Position("e1"))->getPiece()->getPossibleMoves(board);
     
@@ -334,9 +334,9 @@ TEST_F(PiecesTest, KingCheckEvasion) {
 TEST_F(PiecesTest, DiscoveredCheck) {
     clearBoard();
     
-    board->placePiece(new King(Piece::Color::Black), Position("e8"));
-    board->placePiece(new Bishop(Piece::Color::White), Position("e6")); 
-    board->placePiece(new Rook(Piece::Color::White), Position("e1")); 
+    board->placePiece(King(Piece::Color::Black), Position("e8"));
+    board->placePiece(Bishop(Piece::Color::White), Position("e6")); 
+    board->placePiece(Rook(Piece::Color::White), Position("e1")); 
     
     auto bishopMoves = board->getSquare(Position("e6"))->getPiece()->getPossibleMoves(board);
     
@@ -363,19 +363,19 @@ TEST_F(PiecesTest, DiscoveredCheck) {
 TEST_F(PiecesTest, PieceMobility) {
     clearBoard();
     
-    board->placePiece(new Knight(Piece::Color::White), Position("d4"));
+    board->placePiece(Knight(Piece::Color::White), Position("d4"));
     auto centerKnightMoves = board->getSquare(Position("d4"))->getPiece()->getPossibleMoves(board);
     EXPECT_EQ(centerKnightMoves.size(), 8); // Конь в центре имеет 8 ходов
     
-    board->placePiece(new Knight(Piece::Color::White), Position("a1"));
+    board->placePiece(Knight(Piece::Color::White), Position("a1"));
     auto cornerKnightMoves = board->getSquare(Position("a1"))->getPiece()->getPossibleMoves(board);
     EXPECT_EQ(cornerKnightMoves.size(), 2); // Конь в углу имеет 2 хода
 }
 
 TEST_F(PiecesTest, BlockedPieces) {
     clearBoard();
-    board->placePiece(new Rook(Piece::Color::White), Position("a1"));
-    board->placePiece(new Pawn(Piece::Color::White), Position("a2"));
+    board->placePiece(Rook(Piece::Color::White), Position("a1"));
+    board->placePiece(Pawn(Piece::Color::White), Position("a2"));
     
     auto rookMoves = board->getSquare(Position("a1"))->getPiece()->getPossibleMoves(board);
     
@@ -384,7 +384,7 @@ TEST_F(PiecesTest, BlockedPieces) {
 }
 TEST_F(PiecesTest, QueenCombinedMoves) {
     clearBoard();
-    board->placePiece(new Queen(Piece::Color::White), Position("d4"));
+    board->placePiece(Queen(Piece::Color::White), Position("d4"));
     auto queenMoves = board->getSquare(Position("d4"))->getPiece()->getPossibleMoves(board);
     
     EXPECT_TRUE(containsPosition(queenMoves, Position("a1")));
@@ -398,9 +398,9 @@ TEST_F(PiecesTest, QueenCombinedMoves) {
 
 TEST_F(PiecesTest, KingCastlingSafety) {
     clearBoard();
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    board->placePiece(new Rook(Piece::Color::White), Position("h1"));
-    board->placePiece(new Rook(Piece::Color::Black), Position("e8"));
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    board->placePiece(Rook(Piece::Color::White), Position("h1"));
+    board->placePiece(Rook(Piece::Color::Black), Position("e8"));
     
     auto kingMoves = board->getSquare(Position("e1"))->getPiece()->getPossibleMoves(board);
     
@@ -421,4 +421,33 @@ TEST_F(PiecesTest, PieceValues) {
     EXPECT_EQ(rook.getValue(), 5);
     EXPECT_EQ(queen.getValue(), 9);
     EXPECT_EQ(king.getValue(), 0); 
-}
\ No newline at end of file
+}
+
+TEST_F(PiecesTest, PieceCodeEncoding) {
+    Piece blackKnight(Piece::Color::Black, Piece::Type::Knight);
+    EXPECT_EQ(blackKnight.getCode(), Piece::Code::BlackKnight);
+    EXPECT_EQ(blackKnight.getColor(), Piece::Color::Black);
+    EXPECT_EQ(blackKnight.getType(), Piece::Type::Knight);
+    EXPECT_EQ(blackKnight.getSymbol(), 'n');
+    EXPECT_TRUE(Piece().isNone());
+}
+
+TEST_F(PiecesTest, BoardCopyIsIndependent) {
+    setupBasicPosition();
+    Board copy(*board);
+    copy.movePiece(Position("e2"), Position("e4"));
+
+    EXPECT_TRUE(board->getSquare(Position("e2"))->isOccupied());
+    EXPECT_FALSE(board->getSquare(Position("e4"))->isOccupied());
+    EXPECT_EQ(copy.getSquare(Position("e4"))->getPiece()->getType(), Piece::Type::Pawn);
+}
+
+TEST_F(PiecesTest, SquareIndexRoundTrip) {
+    EXPECT_EQ(Position("a1").toIndex(), 0);
+    EXPECT_EQ(Position("h1").toIndex(), 7);
+    EXPECT_EQ(Position("a8").toIndex(), 56);
+    for (int index = 0; index < Board::SQUARE_COUNT; ++index) {
+        EXPECT_EQ(Position::fromIndex(index).toIndex(), index);
+        EXPECT_EQ(board->getSquareAt(index).getPosition(), Position::fromIndex(index));
+    }
+}
@@ -27,7 +27,7 @@ TEST_F(RookTest, InitialPosition) {
 
 TEST_F(RookTest, ValidMoves) {
     Rook rook(Piece::Color::White, Position(3, 3));
-    board->placePiece(&rook, Position(3, 3));
+    board->placePiece(rook, Position(3, 3));
     
     auto moves = rook.getPossibleMoves(board);
     
@@ -36,36 +36,31 @@ TEST_F(RookTest, ValidMoves) {
 
 TEST_F(RookTest, BlockedMoves) {
     Rook rook(Piece::Color::White, Position(3, 3));
-    board->placePiece(&rook, Position(3, 3));
+    board->placePiece(rook, Position(3, 3));
     
-    Piece* blockingPiece1 = new Rook(Piece::Color::White, Position(3, 4));
-    Piece* blockingPiece2 = new Rook(Piece::Color::White, Position(4, 3));
+    Rook blockingPiece1(Piece::Color::White, Position(3, 4));
+    Rook blockingPiece2(Piece::Color::White, Position(4, 3));
     board->placePiece(blockingPiece1, Position(3, 4));
     board->placePiece(blockingPiece2, Position(4, 3));
     
     auto moves = rook.getPossibleMoves(board);
     
     EXPECT_LT(moves.size(), 14);
-    
-    delete blockingPiece1;
-    delete blockingPiece2;
 }
 
 TEST_F(RookTest, CaptureMove) {
     Rook rook(Piece::Color::White, Position(3, 3));
-    board->placePiece(&rook, Position(3, 3));
+    board->placePiece(rook, Position(3, 3));
     
-    Piece* enemyPiece = new Rook(Piece::Color::Black, Position(3, 6));
+    Rook enemyPiece(Piece::Color::Black, Position(3, 6));
     board->placePiece(enemyPiece, Position(3, 6));
     
     EXPECT_TRUE(rook.canMoveTo(Position(3, 6), board));
-    
-    delete enemyPiece;
 }
 
 TEST_F(RookTest, InvalidMoves) {
     Rook rook(Piece::Color::White, Position(3, 3));
-    board->placePiece(&rook, Position(3, 3));
+    board->placePiece(rook, Position(3, 3));
     
     EXPECT_FALSE(rook.canMoveTo(Position(4, 4), board));
     EXPECT_FALSE(rook.canMoveTo(Position(2, 4), board));
@@ -75,7 +70,7 @@ TEST_F(RookTest, InvalidMoves) {
 
 TEST_F(RookTest, AttackedSquares) {
     Rook rook(Piece::Color::White, Position(3, 3));
-    board->placePiece(&rook, Position(3, 3));
+    board->placePiece(rook, Position(3, 3));
     
     auto attackedSquares = rook.getAttackedSquares(board);
     auto possibleMoves = rook.getPossibleMoves(board);
@@ -83,23 +78,23 @@ TEST_F(RookTest, AttackedSquares) {
     EXPECT_EQ(attackedSquares.size(), possibleMoves.size());
 }
 TEST_F(RookTest, DiagonallyPinnedMoves) {
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    Rook* rook = new Rook(Piece::Color::White);
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    Rook rook(Piece::Color::White, Position("d2"));
     board->placePiece(rook, Position("d2"));
-    board->placePiece(new Queen(Piece::Color::Black), Position("c3"));
+    board->placePiece(Queen(Piece::Color::Black), Position("c3"));
     
-    auto moves = rook->getPossibleMoves(board);
+    auto moves = rook.getPossibleMoves(board);
     EXPECT_TRUE(moves.empty()) 
         << "Rook pinned diagonally should not have any legal moves";
 }
 
 TEST_F(RookTest, MovesUnderCheckValidation) {
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    Rook* rook = new Rook(Piece::Color::White);
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    Rook rook(Piece::Color::White, Position("e2"));
     board->placePiece(rook, Position("e2"));
-    board->placePiece(new Rook(Piece::Color::Black), Position("e8"));
+    board->placePiece(Rook(Piece::Color::Black), Position("e8"));
     
-    auto moves = rook->getPossibleMoves(board);
+    auto moves = rook.getPossibleMoves(board);
     for (const auto& move : moves) {
         EXPECT_EQ(move.getX(), 4) 
             << "Rook cannot move away from protecting the king";
@@ -107,12 +102,12 @@ TEST_F(RookTest, MovesUnderCheckValidation) {
 }
 
 TEST_F(RookTest, CaptureToSaveKing) {
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    Rook* rook = new Rook(Piece::Color::White);
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    Rook rook(Piece::Color::White, Position("a3"));
     board->placePiece(rook, Position("a3"));
-    board->placePiece(new Queen(Piece::Color::Black), Position("e3"));
+    board->placePiece(Queen(Piece::Color::Black), Position("e3"));
     
-    auto moves = rook->getPossibleMoves(board);
+    auto moves = rook.getPossibleMoves(board);
 
     bool canCaptureQueen = false;
     for (const auto& move : moves) {
@@ -123,15 +118,15 @@ TEST_F(RookTest, CaptureToSaveKing) {
 }
 
 TEST_F(RookTest, LegalMovesValidation) {
-    board->placePiece(new King(Piece::Color::White), Position("e1"));
-    Rook* rook = new Rook(Piece::Color::White);
+    board->placePiece(King(Piece::Color::White), Position("e1"));
+    Rook rook(Piece::Color::White, Position("a1"));
     board->placePiece(rook, Position("a1"));
-    board->placePiece(new Bishop(Piece::Color::Black), Position("c3"));
+    board->placePiece(Bishop(Piece::Color::Black), Position("c3"));
     
-    auto moves = rook->getPossibleMoves(board);
+    auto moves = rook.getPossibleMoves(board);
     for (const auto& move : moves) {
         Board tempBoard(*board);
-        tempBoard.movePiece(rook->getPosition(), move);
+        tempBoard.movePiece(rook.getPosition(), move);
         EXPECT_FALSE(tempBoard.isCheck(Piece::Color::White))
             << "Rook move should not result in check to own king";
     }
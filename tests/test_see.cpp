@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include "board/Board.hpp"
+#include "board/StaticExchange.hpp"
+
+class StaticExchangeTest : public ::testing::Test {
+protected:
+    int see(const std::string& fen, const Move& move) {
+        Piece::Color side;
+        EXPECT_TRUE(board.setupFromFEN(fen, side)) << fen;
+        return StaticExchange::evaluate(board, move);
+    }
+
+    Board board;
+};
+
+TEST_F(StaticExchangeTest, UndefendedCapture) {
+    EXPECT_EQ(see("1k1r4/1pp4p/p7/4p3/8/P5P1/1PP4P/2K1R3 w - - 0 1",
+                  Move(Position("e1"), Position("e5"), Move::Type::Capture)), 100);
+}
+
+TEST_F(StaticExchangeTest, XRaysJoinTheExchange) {
+    // NxP NxN RxN BxR QxB QxQ: the queens behind the rook and bishop both take part.
+    EXPECT_EQ(see("1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - - 0 1",
+                  Move(Position("d3"), Position("e5"), Move::Type::Capture)), -220);
+}
+
+TEST_F(StaticExchangeTest, DefenderMayDeclineRecapture) {
+    // PxN is answered by nothing sensible: recapturing with the queen loses it to the rook.
+    EXPECT_EQ(see("4k3/8/3q4/4n3/3P4/8/8/4RK2 w - - 0 1",
+                  Move(Position("d4"), Position("e5"), Move::Type::Capture)), 320);
+}
+
+TEST_F(StaticExchangeTest, PromotionAndEnPassant) {
+    EXPECT_EQ(see("1n2k3/P7/8/8/8/8/8/4K3 w - - 0 1",
+                  Move(Position("a7"), Position("b8"), Move::Type::Promotion, Piece::Type::Queen)), 1120);
+    EXPECT_EQ(see("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1",
+                  Move(Position("e5"), Position("d6"), Move::Type::EnPassant)), 100);
+}
+
+TEST_F(StaticExchangeTest, KingDoesNotRecaptureIntoDefendedSquare) {
+    // QxP is met by KxQ only if the rook does not guard d7.
+    EXPECT_EQ(see("8/3pk3/8/8/8/8/8/3QK3 w - - 0 1",
+                  Move(Position("d1"), Position("d7"), Move::Type::Capture)), -800);
+    EXPECT_EQ(see("3R4/3pk3/8/8/8/8/8/3QK3 w - - 0 1",
+                  Move(Position("d1"), Position("d7"), Move::Type::Capture)), 100);
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include "uci/UciEngine.hpp"
+#include <chrono>
+#include <sstream>
+
+class UciEngineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        engine = new UciEngine(input, output);
+    }
+
+    void TearDown() override {
+        delete engine;
+    }
+
+    bool outputContains(const std::string& text) const {
+        return output.str().find(text) != std::string::npos;
+    }
+
+    std::istringstream input;
+    std::ostringstream output;
+    UciEngine* engine;
+};
+
+TEST_F(UciEngineTest, Handshake) {
+    engine->handleCommand("uci");
+    engine->handleCommand("isready");
+
+    EXPECT_TRUE(outputContains("id name"));
+    EXPECT_TRUE(outputContains("option name Depth"));
+    EXPECT_TRUE(outputContains("uciok"));
+    EXPECT_TRUE(outputContains("readyok"));
+}
+
+TEST_F(UciEngineTest, PositionWithMoves) {
+    engine->handleCommand("position startpos moves e2e4 e7e5 g1f3");
+
+    const Board& board = engine->getBoard();
+    EXPECT_EQ(engine->getSideToMove(), Piece::Color::Black);
+    ASSERT_TRUE(board.getSquare(Position("f3"))->isOccupied());
+    EXPECT_EQ(board.getSquare(Position("f3"))->getPiece()->getType(), Piece::Type::Knight);
+    EXPECT_FALSE(board.getSquare(Position("e7"))->isOccupied());
+}
+
+TEST_F(UciEngineTest, PositionFromFenWithPromotion) {
+    engine->handleCommand("position fen 4k3/P7/8/8/8/8/8/4K3 w - - 0 1 moves a7a8n");
+
+    const Square* square = engine->getBoard().getSquare(Position("a8"));
+    ASSERT_TRUE(square->isOccupied());
+    EXPECT_EQ(square->getPiece()->getType(), Piece::Type::Knight);
+    EXPECT_EQ(engine->getSideToMove(), Piece::Color::Black);
+}
+
+TEST_F(UciEngineTest, IllegalMoveIsReported) {
+    engine->handleCommand("position startpos moves e2e5");
+
+    EXPECT_TRUE(outputContains("illegal move e2e5"));
+    EXPECT_EQ(engine->getSideToMove(), Piece::Color::White);
+}
+
+TEST_F(UciEngineTest, GoDepthReportsBestMove) {
+    engine->handleCommand("position startpos");
+    engine->handleCommand("go depth 1");
+    engine->waitForSearch();
+
+    EXPECT_TRUE(outputContains("bestmove "));
+    EXPECT_FALSE(outputContains("bestmove 0000"));
+    EXPECT_TRUE(outputContains("info depth 1 seldepth 1 score cp "));
+}
+
+TEST_F(UciEngineTest, InfoScoreIsInCentipawns) {
+    engine->handleCommand("position fen 4k3/8/8/8/8/8/8/R3K3 w - - 0 1");
+    engine->handleCommand("go depth 1");
+    engine->waitForSearch();
+
+    const std::string text = output.str();
+    const std::size_t at = text.find("score cp ");
+    ASSERT_NE(at, std::string::npos);
+    const int cp = std::stoi(text.substr(at + 9));
+    EXPECT_GT(cp, 300);
+    EXPECT_LT(cp, 800);
+}
+
+TEST_F(UciEngineTest, InfoReportsMateInMoves) {
+    engine->handleCommand("position fen 6k1/5ppp/8/8/8/8/5PPP/4R1K1 w - - 0 1");
+    engine->handleCommand("go depth 2");
+    engine->waitForSearch();
+    EXPECT_TRUE(outputContains("score mate 1 "));
+    EXPECT_FALSE(outputContains("999999"));
+
+    engine->handleCommand("position fen 1R4k1/4rppp/8/8/8/8/5PPP/3R2K1 b - - 1 1");
+    engine->handleCommand("go depth 2");
+    engine->waitForSearch();
+    EXPECT_TRUE(outputContains("score mate -1 "));
+}
+
+TEST_F(UciEngineTest, TablebaseWinIsNotReportedAsMate) {
+    // Kxd2 or Qxd2 reaches a won KQK ending, which is not a forced mate within the search.
+    engine->handleCommand("position fen 4k3/8/8/8/8/8/3r4/3QK3 w - - 0 1");
+    engine->handleCommand("go depth 2");
+    engine->waitForSearch();
+    EXPECT_TRUE(outputContains("score cp "));
+    EXPECT_FALSE(outputContains("score mate"));
+}
+
+TEST_F(UciEngineTest, MultiPvReportsEveryLine) {
+    engine->handleCommand("setoption name MultiPV value 2");
+    engine->handleCommand("position startpos");
+    engine->handleCommand("go depth 1");
+    engine->waitForSearch();
+
+    EXPECT_TRUE(outputContains("info depth 1 seldepth 1 multipv 1 score cp "));
+    EXPECT_TRUE(outputContains("info depth 1 seldepth 1 multipv 2 score cp "));
+    EXPECT_FALSE(outputContains("multipv 3"));
+}
+
+TEST_F(UciEngineTest, StopEndsInfiniteSearch) {
+    engine->handleCommand("position startpos");
+    engine->handleCommand("go infinite");
+
+    const auto start = std::chrono::steady_clock::now();
+    engine->handleCommand("stop");
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(outputContains("bestmove "));
+    EXPECT_LT(elapsed, std::chrono::seconds(1));
+}
+
+TEST_F(UciEngineTest, PonderHitSwitchesToTimedSearch) {
+    engine->handleCommand("position startpos moves e2e4");
+    engine->handleCommand("go ponder movetime 50");
+    EXPECT_FALSE(outputContains("bestmove"));
+
+    engine->handleCommand("ponderhit");
+    engine->waitForSearch();
+
+    EXPECT_TRUE(outputContains("bestmove "));
+}